@@ -12,9 +12,37 @@
 
 namespace MSTD {
 
+	// Compare elements one by one
+	template<typename InputIt1, typename InputIt2, typename CompOp>
+	bool _auxEqual(InputIt1 first1, InputIt1 last1, InputIt2 first2, CompOp op, MSTD::falseType)
+	{
+		for (; first1 != last1; ++first1, ++first2) {
+			if (!op(*first1, *first2)) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// Compare bytes of contiguous ranges at once
+	template<typename InputIt1, typename InputIt2, typename CompOp>
+	bool _auxEqual(InputIt1 first1, InputIt1 last1, InputIt2 first2, CompOp, MSTD::trueType)
+	{
+		using Value = typename MSTD::IteratorTraits<InputIt1>::ValueType;
+		auto count = last1 - first1;
+		return count <= 0 ||
+			std::memcmp(MSTD::_toAddress(first1), MSTD::_toAddress(first2), count * sizeof(Value)) == 0;
+	}
+
+	// Values of {T} are equal if and only if their bytes are
+	template<typename T>
+	struct _IsBitwiseEqual : MSTD::integralConstant<bool,
+		MSTD::isIntegral<T>::value || MSTD::isPointer<T>::value || MSTD::isEnum<T>::value> {};
+
 	/**
 	 * Compare the elements of [first1, last1) and [first2, first2 + (last1 - first1)],
-	 * no optimization
+	 * bytes are compared at once for contiguous ranges of integers, pointers 
+	 * or enums with default comparison
 	 *
 	 * @param first1 - Start position of range
 	 * @param last1	- End position of range
@@ -28,17 +56,85 @@ namespace MSTD {
 	template<typename InputIt1, typename InputIt2, typename CompOp = std::equal_to<>>
 	bool equal(InputIt1 first1, InputIt1 last1, InputIt2 first2, CompOp op = CompOp())
 	{
-		for (; first1 != last1; ++first1, ++first2) {
-			if (!op(*first1, *first2)) {
-				return false;
-			}
+		using Value1 = typename MSTD::IteratorTraits<InputIt1>::ValueType;
+		using Value2 = typename MSTD::IteratorTraits<InputIt2>::ValueType;
+		return _auxEqual(first1, last1, first2, op,
+					typename MSTD::conditional<
+						MSTD::isContiguousIterator<InputIt1>::value &&
+						MSTD::isContiguousIterator<InputIt2>::value &&
+						MSTD::isSame<Value1, Value2>::value &&
+						_IsBitwiseEqual<Value1>::value &&
+						(MSTD::isSame<CompOp, std::equal_to<>>::value ||
+						 MSTD::isSame<CompOp, std::equal_to<Value1>>::value),
+						MSTD::trueType, MSTD::falseType
+					>::type()
+				);
+	}
+
+	template<typename OutputIt, typename T>
+	void _auxFill(OutputIt first, OutputIt last, const T &val, MSTD::falseType)
+	{
+		for (; first != last; ++first) {
+			*first = val;
 		}
-		return true;
+	}
+
+	// Bytes of contiguous range are set at once
+	template<typename OutputIt, typename T>
+	void _auxFill(OutputIt first, OutputIt last, const T &val, MSTD::trueType)
+	{
+		using Value = typename MSTD::IteratorTraits<OutputIt>::ValueType;
+		const Value byte = static_cast<Value>(val);
+		if (last - first > 0) {
+			unsigned char raw;
+			std::memcpy(&raw, &byte, 1);
+			std::memset(MSTD::_toAddress(first), raw, last - first);
+		}
+	}
+
+	template<typename OutputIt, typename T>
+	void _fillUnsegmented(OutputIt first, OutputIt last, const T &val)
+	{
+		using Value = typename MSTD::IteratorTraits<OutputIt>::ValueType;
+		_auxFill(first, last, val,
+				typename MSTD::conditional<
+					MSTD::isContiguousIterator<OutputIt>::value &&
+					MSTD::isIntegral<Value>::value &&
+					sizeof(Value) == 1,
+					MSTD::trueType, MSTD::falseType
+				>::type()
+			);
+	}
+
+	template<typename OutputIt, typename T>
+	void _segmentedFill(OutputIt first, OutputIt last, const T &val, MSTD::falseType)
+	{
+		_fillUnsegmented(first, last, val);
+	}
+
+	// Fills a segment as a contiguous range
+	template<typename T>
+	struct _FillSegment
+	{
+		const T &val;
+
+		template<typename LocalIt>
+		void operator()(LocalIt first, LocalIt last) const
+		{
+			_fillUnsegmented(first, last, val);
+		}
+	};
+
+	template<typename OutputIt, typename T>
+	void _segmentedFill(OutputIt first, OutputIt last, const T &val, MSTD::trueType)
+	{
+		MSTD::_forEachSegment(first, last, _FillSegment<T>{ val });
 	}
 
 	/**
 	 *  Assigns the given value to the elements in the range [first, last),
-	 *  no optimization.
+	 *  contiguous ranges of bytes are set at once, segmented ranges are
+	 *  filled segment by segment.
 	 *  
 	 * @param first - Start position of range
 	 * @param last	- End position of range
@@ -47,14 +143,35 @@ namespace MSTD {
 	template<typename OutputIt, typename T>
 	void fill(OutputIt first, OutputIt last, const T &val)
 	{
-		for (; first != last; ++first) {
+		_segmentedFill(first, last, val,
+				typename MSTD::conditional<
+					MSTD::isSegmentedIterator<OutputIt>::value,
+					MSTD::trueType, MSTD::falseType
+				>::type()
+			);
+	}
+
+	template<typename OutputIt, typename T>
+	OutputIt _auxFill_N(OutputIt first, size_t n, const T &val, MSTD::falseType)
+	{
+		for (; n > 0; --n, ++first) {
 			*first = val;
 		}
+		return first;
+	}
+
+	template<typename OutputIt, typename T>
+	OutputIt _auxFill_N(OutputIt first, size_t n, const T &val, MSTD::trueType)
+	{
+		auto last = first + n;
+		MSTD::fill(first, last, val);
+		return last;
 	}
 
 	/**
 	 * Assigns the given value to the first count elements in the range beginning 
-	 * at first if count > 0. Does nothing otherwise, no optimization.
+	 * at first if count > 0. Does nothing otherwise, same as fill() for 
+	 * contiguous and segmented ranges.
 	 * 
 	 * @param first - Start position of range	 
 	 * @param n - The number of value to be assigned
@@ -66,10 +183,13 @@ namespace MSTD {
 	template<typename OutputIt, typename T>
 	OutputIt fill_N(OutputIt first, size_t n, const T &val)
 	{
-		for (; n > 0; --n, ++first) {
-			*first = val;
-		}
-		return first;
+		return _auxFill_N(first, n, val,
+				typename MSTD::conditional<
+					MSTD::isContiguousIterator<OutputIt>::value ||
+					MSTD::isSegmentedIterator<OutputIt>::value,
+					MSTD::trueType, MSTD::falseType
+				>::type()
+			);
 	}
 
 	/**
@@ -171,15 +291,105 @@ namespace MSTD {
 	OutputIt _auxCopy(InputIt first, InputIt last, OutputIt dest, MSTD::trueType)
 	{
 		using Value = typename  MSTD::IteratorTraits<InputIt>::ValueType;
-		auto count = MSTD::distance(first, last);
-		const auto firstChar = static_cast<void*>(first);
-		const auto destChar = static_cast<void*>(dest);
-		std::memmove(destChar, firstChar, count * sizeof(Value));
+		auto count = last - first;
+		if (count > 0) {
+			const auto firstChar = static_cast<const void*>(MSTD::_toAddress(first));
+			const auto destChar = static_cast<void*>(MSTD::_toAddress(dest));
+			std::memmove(destChar, firstChar, count * sizeof(Value));
+		}
 		return (dest + count);
 	}
 
+	template<typename InputIt, typename OutputIt>
+	OutputIt _copyUnsegmented(InputIt first, InputIt last, OutputIt dest)
+	{
+		using SourceValue = typename MSTD::IteratorTraits<InputIt>::ValueType;
+		using DestValue = typename MSTD::IteratorTraits<OutputIt>::ValueType;
+
+		return _auxCopy(first, last, dest,
+					typename MSTD::conditional<
+						MSTD::isContiguousIterator<InputIt>::value &&
+						MSTD::isContiguousIterator<OutputIt>::value &&
+						MSTD::isSame<SourceValue, DestValue>::value &&
+						MSTD::isTrviallyCopyAssignble<DestValue>::value,
+						MSTD::trueType, MSTD::falseType
+					>::type()
+				);
+	}
+
+	// Destination is split into segments when the source
+	// can be advanced over a whole segment at once
+	template<typename InputIt, typename OutputIt>
+	using _CopyToSegmentsTag = typename MSTD::conditional<
+		MSTD::isSegmentedIterator<OutputIt>::value &&
+		MSTD::isConvertible<
+			typename MSTD::IteratorTraits<InputIt>::IteratorCategory,
+			MSTD::RandomAccessIteratorTag
+		>::value,
+		MSTD::trueType, MSTD::falseType
+	>::type;
+
+	template<typename InputIt, typename OutputIt>
+	OutputIt _copyToSegments(InputIt first, InputIt last, OutputIt dest, MSTD::falseType)
+	{
+		return _copyUnsegmented(first, last, dest);
+	}
+
+	// Each segment of destination is copied to as a contiguous range
+	template<typename InputIt, typename OutputIt>
+	OutputIt _copyToSegments(InputIt first, InputIt last, OutputIt dest, MSTD::trueType)
+	{
+		using _Traits = MSTD::SegmentedIteratorTraits<OutputIt>;
+		auto count = last - first;
+		if (count <= 0) {
+			return dest;
+		}
+
+		auto seg = _Traits::segment(dest);
+		auto pos = _Traits::local(dest);
+		for (;;) {
+			auto room = _Traits::end(seg) - pos;
+			if (count <= room) {
+				return _Traits::compose(seg, _copyUnsegmented(first, last, pos));
+			}
+			_copyUnsegmented(first, first + room, pos);
+			first += room;
+			count -= room;
+			++seg;
+			pos = _Traits::begin(seg);
+		}
+	}
+
+	template<typename InputIt, typename OutputIt>
+	OutputIt _copyFromSegments(InputIt first, InputIt last, OutputIt dest, MSTD::falseType)
+	{
+		return _copyToSegments(first, last, dest, _CopyToSegmentsTag<InputIt, OutputIt>());
+	}
+
+	// Copies a segment of source as a contiguous range
+	// and moves {dest} past it
+	template<typename OutputIt>
+	struct _CopySegment
+	{
+		OutputIt &dest;
+
+		template<typename LocalIt>
+		void operator()(LocalIt first, LocalIt last) const
+		{
+			dest = _copyToSegments(first, last, dest, _CopyToSegmentsTag<LocalIt, OutputIt>());
+		}
+	};
+
+	template<typename InputIt, typename OutputIt>
+	OutputIt _copyFromSegments(InputIt first, InputIt last, OutputIt dest, MSTD::trueType)
+	{
+		MSTD::_forEachSegment(first, last, _CopySegment<OutputIt>{ dest });
+		return dest;
+	}
+
 	/**
-	 * Copy the elements of range [first, last) to dest
+	 * Copy the elements of range [first, last) to dest, segmented
+	 * ranges are copied segment by segment.
 	 * 
 	 * @param first - Start position of range
 	 * @param last	- End position of range
@@ -191,16 +401,9 @@ namespace MSTD {
 	template<typename InputIt, typename OutputIt>
 	OutputIt copy(InputIt first, InputIt last, OutputIt dest)
 	{
-		using SourceValue = typename MSTD::IteratorTraits<InputIt>::ValueType;
-		using DestValue = typename MSTD::IteratorTraits<OutputIt>::ValueType;
-		using SourceItType = typename MSTD::IteratorTraits<InputIt>::IteratorCategory;
-		using DestItType = typename MSTD::IteratorTraits<OutputIt>::IteratorCategory;
-
-		return _auxCopy(first, last, dest,
+		return _copyFromSegments(first, last, dest,
 					typename MSTD::conditional<
-						MSTD::isPointer<SourceItType>::value &&
-						MSTD::isPointer<DestItType>::value &&						
-						MSTD::isTrviallyAssignable<DestValue, SourceValue>::value,
+						MSTD::isSegmentedIterator<InputIt>::value,
 						MSTD::trueType, MSTD::falseType
 					>::type()
 				);
@@ -525,7 +728,7 @@ namespace MSTD {
 	{
 		using _Diff = typename MSTD::IteratorTraits<InputIt>::DifferenceType;
 		_Diff count = 0;
-		while (first != last) {
+		for (; first != last; ++first) {
 			if (*first == val) {
 				++count;
 			}
@@ -539,7 +742,7 @@ namespace MSTD {
 	{
 		using _Diff = typename MSTD::IteratorTraits<InputIt>::DifferenceType;
 		_Diff count = 0;
-		while (first != last) {
+		for (; first != last; ++first) {
 			if (op(*first)) {
 				++count;
 			}
@@ -548,9 +751,9 @@ namespace MSTD {
 	}
 
 	template<typename InputIt, typename T>
-	InputIt find(InputIt first, InputIt last, const T &val)
+	InputIt _auxFind(InputIt first, InputIt last, const T &val, MSTD::falseType)
 	{
-		while (first != last) {
+		for (; first != last; ++first) {
 			if (*first == val) {
 				return first;
 			}
@@ -558,10 +761,81 @@ namespace MSTD {
 		return last;
 	}
 
+	// Search bytes of contiguous range at once
+	template<typename InputIt, typename T>
+	InputIt _auxFind(InputIt first, InputIt last, const T &val, MSTD::trueType)
+	{
+		using Value = typename MSTD::IteratorTraits<InputIt>::ValueType;
+		if (last - first <= 0 || static_cast<T>(static_cast<Value>(val)) != val) {
+			// Value can't be held by any element
+			return last;
+		}
+		const Value byte = static_cast<Value>(val);
+		unsigned char raw;
+		std::memcpy(&raw, &byte, 1);
+		auto base = MSTD::_toAddress(first);
+		auto pos = std::memchr(base, raw, last - first);
+		return pos ? first + (static_cast<const unsigned char*>(pos) - 
+							  reinterpret_cast<const unsigned char*>(base))
+				   : last;
+	}
+
+	template<typename InputIt, typename T>
+	InputIt _findUnsegmented(InputIt first, InputIt last, const T &val)
+	{
+		using Value = typename MSTD::IteratorTraits<InputIt>::ValueType;
+		return _auxFind(first, last, val,
+				typename MSTD::conditional<
+					MSTD::isContiguousIterator<InputIt>::value &&
+					MSTD::isIntegral<Value>::value &&
+					MSTD::isIntegral<T>::value &&
+					sizeof(Value) == 1,
+					MSTD::trueType, MSTD::falseType
+				>::type()
+			);
+	}
+
+	template<typename InputIt, typename T>
+	InputIt _segmentedFind(InputIt first, InputIt last, const T &val, MSTD::falseType)
+	{
+		return _findUnsegmented(first, last, val);
+	}
+
+	// Each segment is searched as a contiguous range
+	template<typename InputIt, typename T>
+	InputIt _segmentedFind(InputIt first, InputIt last, const T &val, MSTD::trueType)
+	{
+		using _Traits = MSTD::SegmentedIteratorTraits<InputIt>;
+		auto seg = _Traits::segment(first);
+		auto lastSeg = _Traits::segment(last);
+		auto pos = _Traits::local(first);
+		for (; seg != lastSeg; ++seg, pos = _Traits::begin(seg)) {
+			auto segEnd = _Traits::end(seg);
+			pos = _findUnsegmented(pos, segEnd, val);
+			if (pos != segEnd) {
+				return _Traits::compose(seg, pos);
+			}
+		}
+		auto lastPos = _Traits::local(last);
+		pos = _findUnsegmented(pos, lastPos, val);
+		return pos != lastPos ? _Traits::compose(seg, pos) : last;
+	}
+
+	template<typename InputIt, typename T>
+	InputIt find(InputIt first, InputIt last, const T &val)
+	{
+		return _segmentedFind(first, last, val,
+				typename MSTD::conditional<
+					MSTD::isSegmentedIterator<InputIt>::value,
+					MSTD::trueType, MSTD::falseType
+				>::type()
+			);
+	}
+
 	template<typename InputIt, typename UnaryOp>
 	InputIt findIf(InputIt first, InputIt last, UnaryOp op)
 	{
-		while (first != last) {
+		for (; first != last; ++first) {
 			if (op(*first)) {
 				return first;
 			}
@@ -854,9 +1128,9 @@ namespace MSTD {
 	ForwardIt _auxRotate(ForwardIt first, ForwardIt mid, ForwardIt last,
 						 MSTD::RandomAccessIteratorTag)
 	{
-		reverse(first, mid);
-		reverse(mid, last);
-		reverse(first, last);
+		MSTD::reverse(first, mid);
+		MSTD::reverse(mid, last);
+		MSTD::reverse(first, last);
 		return (first + (last - mid));
 	}
 
@@ -880,7 +1154,7 @@ namespace MSTD {
 	template<typename ForwardIt, typename OutputIt>
 	OutputIt rotateCopy(ForwardIt first, ForwardIt mid, ForwardIt last, OutputIt dest)
 	{
-		return copy(first, mid, copy(mid, last, dest));
+		return MSTD::copy(first, mid, MSTD::copy(mid, last, dest));
 	}
 
 	template<typename ForwardIt1, typename ForwardIt2, typename Equality = std::equal_to<>>
@@ -5,8 +5,81 @@
 
 namespace MSTD {
 	
+	template<typename InputIt, typename T>
+	T _accumulateUnsegmented(InputIt first, InputIt last, T init)
+	{
+		for (; first != last; ++first) {
+			init += *first;
+		}
+		return init;
+	}
+
+	template<typename InputIt, typename T, typename BinaryOp>
+	T _accumulateUnsegmented(InputIt first, InputIt last, T init, BinaryOp &op)
+	{
+		for (; first != last; ++first) {
+			init = op(init, *first);
+		}
+		return init;
+	}
+
+	template<typename InputIt, typename T>
+	T _segmentedAccumulate(InputIt first, InputIt last, T init, MSTD::falseType)
+	{
+		return _accumulateUnsegmented(first, last, MSTD::move(init));
+	}
+
+	// Sums a segment as a contiguous range into {init}
+	template<typename T>
+	struct _AccumulateSegment
+	{
+		T &init;
+
+		template<typename LocalIt>
+		void operator()(LocalIt first, LocalIt last) const
+		{
+			init = _accumulateUnsegmented(first, last, MSTD::move(init));
+		}
+	};
+
+	// Same as above with user defined binary operator
+	template<typename T, typename BinaryOp>
+	struct _AccumulateSegmentOp
+	{
+		T &init;
+		BinaryOp &op;
+
+		template<typename LocalIt>
+		void operator()(LocalIt first, LocalIt last) const
+		{
+			init = _accumulateUnsegmented(first, last, MSTD::move(init), op);
+		}
+	};
+
+	// Segments are summed in order
+	template<typename InputIt, typename T>
+	T _segmentedAccumulate(InputIt first, InputIt last, T init, MSTD::trueType)
+	{
+		MSTD::_forEachSegment(first, last, _AccumulateSegment<T>{ init });
+		return init;
+	}
+
+	template<typename InputIt, typename T, typename BinaryOp>
+	T _segmentedAccumulate(InputIt first, InputIt last, T init, BinaryOp &op, MSTD::falseType)
+	{
+		return _accumulateUnsegmented(first, last, MSTD::move(init), op);
+	}
+
+	template<typename InputIt, typename T, typename BinaryOp>
+	T _segmentedAccumulate(InputIt first, InputIt last, T init, BinaryOp &op, MSTD::trueType)
+	{
+		MSTD::_forEachSegment(first, last, _AccumulateSegmentOp<T, BinaryOp>{ init, op });
+		return init;
+	}
+
 	/**
-	 * Accumulate elements in range [first, last)
+	 * Accumulate elements in range [first, last), segmented
+	 * ranges are summed segment by segment.
 	 * 
 	 * @param first	- Start position of range	 
 	 * @param last	- End position of range
@@ -18,10 +91,12 @@ namespace MSTD {
 	template<typename InputIt, typename T>
 	T accumulate(InputIt first, InputIt last, T init)
 	{
-		for (; first != last; ++first) {
-			init += *first;
-		}
-		return init;
+		return _segmentedAccumulate(first, last, MSTD::move(init),
+				typename MSTD::conditional<
+					MSTD::isSegmentedIterator<InputIt>::value,
+					MSTD::trueType, MSTD::falseType
+				>::type()
+			);
 	}
 
 	// Generic version of accumulate Use user define binary operator 
@@ -29,10 +104,12 @@ namespace MSTD {
 	template<typename InputIt, typename T, typename BinaryOp>
 	T accumulate(InputIt first, InputIt last, T init, BinaryOp op)
 	{
-		for (; first != last; ++first) {
-			init = op(init, *first);
-		}
-		return init;
+		return _segmentedAccumulate(first, last, MSTD::move(init), op,
+				typename MSTD::conditional<
+					MSTD::isSegmentedIterator<InputIt>::value,
+					MSTD::trueType, MSTD::falseType
+				>::type()
+			);
 	}
 
 	/**
@@ -9,6 +9,7 @@
 #include <Utility/forward.h>
 #include <Utility/addressof.h>
 #include <Alloc/MiniAlloc.h>
+#include <cstring>
 
 namespace MSTD {
 #ifdef USE_DIRECT_MALLOC
@@ -17,10 +18,25 @@ namespace MSTD {
 	using alloc = defaultAlloc;
 #endif // USE_DIRECT_MALLOC
 
+	// Storage got by allocateAtLeast or reallocate, {count} objects
+	// fit in it, which is also the count to deallocate
+	template<typename Pointer, typename SizeType>
+	struct AllocResult
+	{
+		Pointer ptr;
+		SizeType count;
+	};
+
 	template<typename T>
 	class Allocator {
 		static_assert(!isConst<T>::value,
 			"Const type is ill formed to be allocated");
+		static_assert(alignof(T) <= _MAX_ALIGN,
+			"Alignment larger than a page isn't supported");
+
+		// Objects aligned beyond blocks of alloc are cut
+		// from larger blocks
+		using _IsOverAligned = integralConstant<bool, (alignof(T) > alloc::_NATURAL_ALIGN)>;
 
 	public:
 		using ValueType = T;
@@ -30,23 +46,67 @@ namespace MSTD {
 		using ConstReference = const T&;
 		using SizeType = size_t;
 		using DifferenceType = ptrdiff_t;
-		/*using reBind = Allocator<U>;*/
-
 		// Constructor
 		Allocator() = default;
 		Allocator(const Allocator &) = default;
 
+		// Rebound from allocator of another type
+		template<typename U>
+		Allocator(const Allocator<U> &) noexcept {}
+
 		Pointer address(Reference lvalue) const noexcept { return MSTD::addressof(lvalue); }
 		ConstPointer address(ConstReference lvalue) const noexcept { return MSTD::addressof(lvalue); }
 
 		T* allocate(SizeType n)
 		{
-			return static_cast<T*>(alloc::alloc(n * sizeof(T)));
+			return static_cast<T*>(alloc::allocAligned(n * sizeof(T), alignof(T)));
+		}
+
+		// Room for {n} objects is rounded up to the size
+		// class it takes, so that the slack can be used
+		AllocResult<T*, SizeType> allocateAtLeast(SizeType n)
+		{
+			auto count = _goodCount(n);
+			return { allocate(count), count };
 		}
 			
 		void deallocate(Pointer p, SizeType n)
 		{
-			alloc::dealloc(p, n * sizeof(T));
+			alloc::deallocAligned(p, n * sizeof(T), alignof(T));
+		}
+
+		// Resize storage {p} of {n} objects to {newCount} 
+		// objects without moving it, false if it can't
+		bool tryExpandInPlace(Pointer p, SizeType n, SizeType newCount) noexcept
+		{
+			return !_IsOverAligned::value &&
+				alloc::tryExpandInPlace(p, n * sizeof(T), newCount * sizeof(T));
+		}
+
+		// Resize storage {p} of {n} objects to room for at
+		// least {newCount} objects, they are moved as bytes,
+		// so they should be trivially relocatable. Large 
+		// storage is moved by remapping its pages
+		AllocResult<T*, SizeType> reallocate(Pointer p, SizeType n, SizeType newCount)
+		{
+			auto count = _goodCount(newCount);
+			return { _reallocate(p, n, count, _IsOverAligned()), count };
+		}
+
+		// Allocate {count} separate objects at once, they
+		// are linked through their first pointer-sized bytes
+		// and the last one links to null
+		T* allocateBatch(SizeType count)
+		{
+			static_assert(sizeof(T) >= sizeof(void*), 
+				"Object is too small to be linked in a batch");
+			return _allocateBatch(count, _IsOverAligned());
+		}
+
+		// Deallocate {count} objects linked like a batch
+		void deallocateBatch(Pointer first, SizeType count)
+		{
+			_deallocateBatch(first, count, _IsOverAligned());
 		}
 
 		constexpr SizeType maxSize() const noexcept
@@ -65,15 +125,214 @@ namespace MSTD {
 		{
 			p->~U();
 		}
+
+	private:
+		// Objects fitting in the block taking {n} objects
+		static SizeType _goodCount(SizeType n) noexcept
+		{
+			return _IsOverAligned::value ? n : alloc::goodSize(n * sizeof(T)) / sizeof(T);
+		}
+
+		T* _reallocate(Pointer p, SizeType n, SizeType newCount, falseType)
+		{
+			return static_cast<T*>(alloc::reallocate(p, n * sizeof(T), newCount * sizeof(T)));
+		}
+
+		T* _reallocate(Pointer p, SizeType n, SizeType newCount, trueType)
+		{
+			// Over-aligned storage is cut from a larger block
+			T *ret = allocate(newCount);
+			if (p) {
+				std::memcpy(static_cast<void*>(ret), static_cast<const void*>(p),
+							(n < newCount ? n : newCount) * sizeof(T));
+				deallocate(p, n);
+			}
+			return ret;
+		}
+
+		T* _allocateBatch(SizeType count, falseType)
+		{
+			return static_cast<T*>(alloc::allocBatch(sizeof(T), count));
+		}
+
+		T* _allocateBatch(SizeType count, trueType)
+		{
+			// Over-aligned objects are allocated one by one
+			T *first = nullptr;
+			SizeType got = 0;
+			_MSTD_TRY
+				for (; got < count; ++got) {
+					T *p = allocate(1);
+					*static_cast<T**>(static_cast<void*>(p)) = first;
+					first = p;
+				}
+			_MSTD_CATCH_ALL
+				_deallocateBatch(first, got, trueType());
+				throw;
+			_MSTD_END_CATCH
+			return first;
+		}
+
+		void _deallocateBatch(Pointer first, SizeType count, falseType)
+		{
+			alloc::deallocBatch(first, sizeof(T), count);
+		}
+
+		void _deallocateBatch(Pointer first, SizeType count, trueType)
+		{
+			for (; count > 0; --count) {
+				T *next = *static_cast<T**>(static_cast<void*>(first));
+				deallocate(first, 1);
+				first = next;
+			}
+		}
 	};
 
-	template<typename T>
+	template<typename T, typename U>
 	inline constexpr
-	bool operator==(const Allocator<T>&, const Allocator<T>&) noexcept { return true; }	
+	bool operator==(const Allocator<T>&, const Allocator<U>&) noexcept { return true; }	
 	
+	template<typename T, typename U>
+	inline constexpr
+	bool operator!=(const Allocator<T>&, const Allocator<U>&) noexcept { return false; }
+
+	// Allocator for objects shared across threads, every
+	// allocation starts at a cache line and covers whole
+	// lines, so it never shares a line with other ones
 	template<typename T>
+	class CacheAlignedAllocator {
+		static_assert(!isConst<T>::value,
+			"Const type is ill formed to be allocated");
+		static_assert(alignof(T) <= _MAX_ALIGN,
+			"Alignment larger than a page isn't supported");
+
+		static constexpr size_t _ALIGN = 
+			alignof(T) > _CACHE_LINE_SIZE ? alignof(T) : _CACHE_LINE_SIZE;
+
+	public:
+		using ValueType = T;
+		using Pointer = T * ;
+		using ConstPointer = const T*;
+		using Reference = T & ;
+		using ConstReference = const T&;
+		using SizeType = size_t;
+		using DifferenceType = ptrdiff_t;
+
+		CacheAlignedAllocator() = default;
+		CacheAlignedAllocator(const CacheAlignedAllocator &) = default;
+
+		template<typename U>
+		CacheAlignedAllocator(const CacheAlignedAllocator<U> &) noexcept {}
+
+		T* allocate(SizeType n)
+		{
+			return static_cast<T*>(alloc::allocAligned(_bytes(n), _ALIGN));
+		}
+
+		void deallocate(Pointer p, SizeType n)
+		{
+			alloc::deallocAligned(p, _bytes(n), _ALIGN);
+		}
+
+		constexpr SizeType maxSize() const noexcept
+		{
+			return static_cast<SizeType>(-1) / sizeof(T);
+		}
+
+		template<typename U, typename... Args>
+		void construct(U *p, Args&&... args)
+		{
+			::new ((void*)p) U(MSTD::forward<Args>(args)...);
+		}
+
+		template<typename U>
+		void destroy(U *p)
+		{
+			p->~U();
+		}
+
+	private:
+		// Bytes of {n} objects rounded up to whole lines
+		static SizeType _bytes(SizeType n) noexcept
+		{
+			return (n * sizeof(T) + _ALIGN - 1) & ~(_ALIGN - 1);
+		}
+	};
+
+	template<typename T, typename U>
+	inline constexpr
+	bool operator==(const CacheAlignedAllocator<T>&, const CacheAlignedAllocator<U>&) noexcept { return true; }
+
+	template<typename T, typename U>
 	inline constexpr
-	bool operator!=(const Allocator<T>&, const Allocator<T>&) noexcept { return false; }
+	bool operator!=(const CacheAlignedAllocator<T>&, const CacheAlignedAllocator<U>&) noexcept { return false; }
+
+	// Replace the first template argument of {Alloc}
+	// with {Other}, e.g. Alloc<T, Args...> -> Alloc<Other, Args...>
+	template<typename Alloc, typename Other>
+	struct _RebindAlloc;
+
+	template<
+		template<typename, typename...> class Alloc, 
+		typename T, typename... Args, typename Other
+	> struct _RebindAlloc<Alloc<T, Args...>, Other>
+	{
+		using type = Alloc<Other, Args...>;
+	};
+
+	// Adaptor of {Alloc} whose construct() with no argument
+	// default-initializes objects instead of value-initializing
+	// them, so containers leave trivial elements uninitialized
+	// when they are resized
+	template<typename T, typename Alloc = Allocator<T>>
+	class DefaultInitAllocator : public Alloc
+	{
+	public:
+		DefaultInitAllocator() = default;
+		DefaultInitAllocator(const DefaultInitAllocator &) = default;
+
+		DefaultInitAllocator(const Alloc &alloc) noexcept :
+			Alloc(alloc)
+		{}
+
+		// Rebound from allocator of another type
+		template<typename U, typename OtherAlloc>
+		DefaultInitAllocator(const DefaultInitAllocator<U, OtherAlloc> &that) noexcept :
+			Alloc(static_cast<const OtherAlloc&>(that))
+		{}
+
+		template<typename U>
+		void construct(U *p) noexcept(isNothrowDefaultConstructible<U>::value)
+		{
+			::new (static_cast<void*>(p)) U;
+		}
+
+		template<typename U, typename... Args>
+		void construct(U *p, Args&&... args)
+		{
+			::new (static_cast<void*>(p)) U(MSTD::forward<Args>(args)...);
+		}
+	};
+
+	template<typename T, typename Alloc, typename Other>
+	struct _RebindAlloc<DefaultInitAllocator<T, Alloc>, Other>
+	{
+		using type = DefaultInitAllocator<Other, typename _RebindAlloc<Alloc, Other>::type>;
+	};
+
+	template<typename T, typename AllocT, typename U, typename AllocU>
+	inline
+	bool operator==(const DefaultInitAllocator<T, AllocT> &lhs, const DefaultInitAllocator<U, AllocU> &rhs) noexcept
+	{
+		return static_cast<const AllocT&>(lhs) == static_cast<const AllocU&>(rhs);
+	}
+
+	template<typename T, typename AllocT, typename U, typename AllocU>
+	inline
+	bool operator!=(const DefaultInitAllocator<T, AllocT> &lhs, const DefaultInitAllocator<U, AllocU> &rhs) noexcept
+	{
+		return !(lhs == rhs);
+	}
 
 	// allocator traits
 
@@ -86,9 +345,15 @@ namespace MSTD {
 		REGISTER_TYPE_TRAIT(ConstVoidPointer);
 		REGISTER_TYPE_TRAIT(DifferenceType);
 		REGISTER_TYPE_TRAIT(SizeType);
+		REGISTER_TYPE_TRAIT(IsBulkReleased);
 
 		REGISTER_FUNCTION_CHECK(construct);
 		REGISTER_FUNCTION_CHECK(destroy);
+		REGISTER_FUNCTION_CHECK(allocateBatch);
+		REGISTER_FUNCTION_CHECK(deallocateBatch);
+		REGISTER_FUNCTION_CHECK(allocateAtLeast);
+		REGISTER_FUNCTION_CHECK(tryExpandInPlace);
+		REGISTER_FUNCTION_CHECK(reallocate);
 	public:
 		using AllocatorType = Alloc;
 		using ValueType = typename Alloc::ValueType;
@@ -99,11 +364,23 @@ namespace MSTD {
 		using DifferenceType = typename _DifferenceType_Trait_<Alloc>::type;
 		using SizeType = typename _SizeType_Trait_<Alloc>::type;
 
+		// trueType if {Alloc} declares IsBulkReleased as trueType,
+		// which means deallocate() is a no-op and memory is given
+		// back all at once by its owner, containers of trivially
+		// destructible values then needn't visit every node to
+		// tear down
+		using IsBulkReleased = typename conditional<
+			isSame<typename _IsBulkReleased_Trait_<Alloc>::type, trueType>::value,
+			trueType, falseType
+		>::type;
+
+		// Allocator of type {Other} sharing the state of
+		// {Alloc}, constructible from an {Alloc} object
 		template<typename Other>
-		using rebind = Allocator<Other>;
+		using rebind = typename _RebindAlloc<Alloc, Other>::type;
 
 		template<typename Other>
-		using rebindTraits = AllocatorTraits<Allocator<Other>>;
+		using rebindTraits = AllocatorTraits<rebind<Other>>;
 
 		static Pointer allocate(Alloc &a, SizeType n)
 		{
@@ -115,6 +392,158 @@ namespace MSTD {
 			a.deallocate(p, n);
 		}
 
+		// {a} has member allocateAtLeast
+		static AllocResult<Pointer, SizeType> _auxAllocateAtLeast(trueType, Alloc &a, SizeType n)
+		{
+			return a.allocateAtLeast(n);
+		}
+
+		// {a} doesn't have member allocateAtLeast
+		static AllocResult<Pointer, SizeType> _auxAllocateAtLeast(falseType, Alloc &a, SizeType n)
+		{
+			return { allocate(a, n), n };
+		}
+
+		// Allocate room for at least {n} objects, the allocator
+		// may give more if they come for free
+		static AllocResult<Pointer, SizeType> allocateAtLeast(Alloc &a, SizeType n)
+		{
+			return _auxAllocateAtLeast(
+				typename conditional<
+					_allocateAtLeast_Func_<Alloc, AllocResult<Pointer, SizeType>(Alloc::*)(SizeType)>::exist,
+					trueType, falseType>::type(),
+				a, n);
+		}
+
+		// {a} has member tryExpandInPlace
+		static bool _auxTryExpandInPlace(trueType, Alloc &a, Pointer p, SizeType n, SizeType newCount)
+		{
+			return a.tryExpandInPlace(p, n, newCount);
+		}
+
+		// {a} doesn't have member tryExpandInPlace
+		static bool _auxTryExpandInPlace(falseType, Alloc &, Pointer, SizeType n, SizeType newCount)
+		{
+			return n == newCount;
+		}
+
+		// Resize storage {p} of {n} objects to {newCount}
+		// objects without moving it, then it is deallocated
+		// with {newCount}. False if it can't be done
+		static bool tryExpandInPlace(Alloc &a, Pointer p, SizeType n, SizeType newCount)
+		{
+			return _auxTryExpandInPlace(
+				typename conditional<
+					_tryExpandInPlace_Func_<Alloc, bool(Alloc::*)(Pointer, SizeType, SizeType)>::exist,
+					trueType, falseType>::type(),
+				a, p, n, newCount);
+		}
+
+		// {a} has member reallocate
+		static AllocResult<Pointer, SizeType> _auxReallocate(trueType, Alloc &a, Pointer p, SizeType n, SizeType newCount)
+		{
+			return a.reallocate(p, n, newCount);
+		}
+
+		// {a} doesn't have member reallocate
+		static AllocResult<Pointer, SizeType> _auxReallocate(falseType, Alloc &a, Pointer p, SizeType n, SizeType newCount)
+		{
+			auto result = allocateAtLeast(a, newCount);
+			if (p) {
+				std::memcpy(static_cast<void*>(MSTD::_toAddress(result.ptr)),
+							static_cast<const void*>(MSTD::_toAddress(p)),
+							(n < newCount ? n : newCount) * sizeof(ValueType));
+				deallocate(a, p, n);
+			}
+			return result;
+		}
+
+		// Resize storage {p} of {n} objects to room for at 
+		// least {newCount} objects, which are moved as bytes,
+		// so they should be trivially relocatable. Storage
+		// is given back on success only
+		static AllocResult<Pointer, SizeType> reallocate(Alloc &a, Pointer p, SizeType n, SizeType newCount)
+		{
+			return _auxReallocate(
+				typename conditional<
+					_reallocate_Func_<Alloc, AllocResult<Pointer, SizeType>(Alloc::*)(Pointer, SizeType, SizeType)>::exist,
+					trueType, falseType>::type(),
+				a, p, n, newCount);
+		}
+
+		// Object linked after {p} in a batch
+		static Pointer& nextOfBatch(Pointer p) noexcept
+		{
+			static_assert(sizeof(ValueType) >= sizeof(Pointer),
+				"Object is too small to be linked in a batch");
+			return *static_cast<Pointer*>(static_cast<void*>(p));
+		}
+
+		// {a} has member allocateBatch
+		static Pointer _auxAllocateBatch(trueType, Alloc &a, SizeType count)
+		{
+			return a.allocateBatch(count);
+		}
+
+		// {a} doesn't have member allocateBatch
+		static Pointer _auxAllocateBatch(falseType, Alloc &a, SizeType count)
+		{
+			Pointer first = nullptr;
+			SizeType n = 0;
+			_MSTD_TRY
+				for (; n < count; ++n) {
+					Pointer p = allocate(a, 1);
+					nextOfBatch(p) = first;
+					first = p;
+				}
+			_MSTD_CATCH_ALL
+				deallocateBatch(a, first, n);
+				throw;
+			_MSTD_END_CATCH
+			return first;
+		}
+
+		// Allocate {count} objects linked through nextOfBatch,
+		// null if {count} is 0
+		static Pointer allocateBatch(Alloc &a, SizeType count)
+		{
+			if (count == 0) {
+				return nullptr;
+			}
+			return _auxAllocateBatch(
+				typename conditional<_allocateBatch_Func_<Alloc, Pointer(Alloc::*)(SizeType)>::exist,
+									trueType, falseType>::type(),
+				a, count);
+		}
+
+		// {a} has member deallocateBatch
+		static void _auxDeallocateBatch(trueType, Alloc &a, Pointer first, SizeType count)
+		{
+			a.deallocateBatch(first, count);
+		}
+
+		// {a} doesn't have member deallocateBatch
+		static void _auxDeallocateBatch(falseType, Alloc &a, Pointer first, SizeType count)
+		{
+			for (; count > 0; --count) {
+				Pointer next = nextOfBatch(first);
+				deallocate(a, first, 1);
+				first = next;
+			}
+		}
+
+		// Deallocate {count} objects linked through nextOfBatch
+		static void deallocateBatch(Alloc &a, Pointer first, SizeType count)
+		{
+			if (count == 0) {
+				return;
+			}
+			_auxDeallocateBatch(
+				typename conditional<_deallocateBatch_Func_<Alloc, void(Alloc::*)(Pointer, SizeType)>::exist,
+									trueType, falseType>::type(),
+				a, first, count);
+		}
+
 		// {a} has member construct
 		template<typename T, typename... Args>
 		static void _auxConstruct(trueType, Alloc &a, T *p, Args&&... args)
@@ -133,9 +562,9 @@ namespace MSTD {
 		static void construct(Alloc &a, T *p, Args&&... args)
 		{
 			_auxConstruct(
-				typename conditional<_construct_Func_<Alloc, void(Alloc::*)(Args...)>::exist, 
+				typename conditional<_construct_Func_<Alloc, void(Alloc::*)(T*, Args...)>::exist, 
 									trueType, falseType>::type(),
-				a, p, args...);
+				a, p, MSTD::forward<Args>(args)...);
 		}
 
 		// {a} has member destroy
@@ -164,6 +593,101 @@ namespace MSTD {
 		static SizeType maxSize(Alloc &a) { return static_cast<SizeType>(-1) / sizeof(ValueType); }
 	};
 
+	// Spare nodes of a container.
+	// Nodes are reserved in one batch and taken one by 
+	// one, nodes given back are kept as well.
+	// All spare nodes are deallocated in one batch when
+	// it goes out of scope
+	template<typename Alloc>
+	class _NodeBatch
+	{
+		using _Traits = AllocatorTraits<Alloc>;
+		using _Pointer = typename _Traits::Pointer;
+		using _SizeType = typename _Traits::SizeType;
+
+	public:
+		explicit _NodeBatch(Alloc &alloc) noexcept :
+			_alloc(alloc),
+			_first(nullptr),
+			_count(0)
+		{}
+
+		_NodeBatch(const _NodeBatch &) = delete;
+		_NodeBatch& operator=(const _NodeBatch &) = delete;
+
+		~_NodeBatch()
+		{
+			_Traits::deallocateBatch(_alloc, _first, _count);
+		}
+
+		// Allocate {count} more spare nodes
+		void reserve(_SizeType count)
+		{
+			if (count == 0) {
+				return;
+			}
+			_Pointer first = _Traits::allocateBatch(_alloc, count);
+			_Pointer last = first;
+			while (_Traits::nextOfBatch(last)) {
+				last = _Traits::nextOfBatch(last);
+			}
+			_Traits::nextOfBatch(last) = _first;
+			_first = first;
+			_count += count;
+		}
+
+		// Reserve a node for each element in [first, last)
+		// if its length is known in advance
+		template<typename InputIt>
+		void reserve(InputIt first, InputIt last)
+		{
+			_auxReserve(first, last,
+				typename conditional<
+					isConvertible<typename IteratorTraits<InputIt>::IteratorCategory, ForwardIteratorTag>::value,
+					trueType, falseType
+				>::type());
+		}
+
+		// Take a spare node, or allocate a new one if 
+		// there isn't any
+		_Pointer take()
+		{
+			if (!_first) {
+				return _Traits::allocate(_alloc, 1);
+			}
+			_Pointer p = _first;
+			_first = _Traits::nextOfBatch(p);
+			--_count;
+			return p;
+		}
+
+		// Keep {p} as a spare node, its element should 
+		// have been destroyed
+		void give(_Pointer p) noexcept
+		{
+			_Traits::nextOfBatch(p) = _first;
+			_first = p;
+			++_count;
+		}
+
+	private:
+		template<typename InputIt>
+		void _auxReserve(InputIt, InputIt, falseType)
+		{
+			// Length is unknown, take nodes one by one
+		}
+
+		template<typename ForwardIt>
+		void _auxReserve(ForwardIt first, ForwardIt last, trueType)
+		{
+			reserve(static_cast<_SizeType>(MSTD::distance(first, last)));
+		}
+
+		Alloc &_alloc;
+		_Pointer _first;
+		_SizeType _count;
+	};
+
 
 	template<typename InputIter, typename ForwardIter>
 	ForwardIter _aux_UninitializedCopy(InputIter first, InputIter last,
@@ -184,17 +708,19 @@ namespace MSTD {
 		return current;
 	}
 
-	//template<typename InputIter, typename ForwardIter>
-	//ForwardIter _aux_UninitializedCopy(InputIter first, InputIter last,
-	//									ForwardIter dest, trueType)
-	//{	// Can be trivially constructed
-	//	using ValueType = typename IteratorTraits<ForwardIter>::ValueType;
-	//	auto count = last - first;		
-	//	std::memmove(static_cast<void*>(MSTD::addressof(*dest)),
-	//				 static_cast<void*>(MSTD::addressof(*first)),
-	//				 count * sizeof(ValueType));
-	//	return dest + count;
-	//}
+	template<typename InputIter, typename ForwardIter>
+	ForwardIter _aux_UninitializedCopy(InputIter first, InputIter last,
+										ForwardIter dest, trueType)
+	{	// Can be trivially constructed
+		using ValueType = typename IteratorTraits<ForwardIter>::ValueType;
+		auto count = last - first;
+		if (count > 0) {
+			std::memmove(static_cast<void*>(MSTD::_toAddress(dest)),
+						 static_cast<const void*>(MSTD::_toAddress(first)),
+						 count * sizeof(ValueType));
+		}
+		return dest + count;
+	}
 
 	/**
 	 *	Copies elements from the range [first, last) to an 
@@ -216,16 +742,15 @@ namespace MSTD {
 		static_assert(isConvertible<ValueTypeSrc, ValueType>::value,
 					  "Uncompatible value type(SrcType -> DestType");
 
-		using InputCat = typename IteratorTraits<InputIter>::IteratorCategory;
-		using ForwardCat = typename IteratorTraits<ForwardIter>::IteratorCategory;
+		// Ranges of contiguous iterators are copied at once
 		return _aux_UninitializedCopy(
 			first, last, dest,
 			typename conditional<
-				isSame<ValueType, ValueTypeSrc>::value				&&
-				isSame<RandomAccessIteratorTag, InputCat>::value	&&
-				isSame<RandomAccessIteratorTag, ForwardCat>::value	&&
+				isSame<ValueType, ValueTypeSrc>::value		&&
+				isContiguousIterator<InputIter>::value		&&
+				isContiguousIterator<ForwardIter>::value	&&
 				isTriviallyCopyConstructible<ValueType>::value,
-				/*trueType*/falseType, falseType
+				trueType, falseType
 			>::type()
 		);
 	}
@@ -0,0 +1,244 @@
+#pragma once
+
+// Arena allocator header
+
+#include <Alloc/Allocator.h>
+#include <cstddef>
+#include <new>
+
+namespace MSTD {
+
+	// Monotonic buffer arena.
+	// Memory is bump allocated from chunks and never
+	// given back one by one, all of it is dropped at once
+	// by release() or when the arena is destroyed.
+	// Not thread safe
+	class MonotonicArena
+	{
+	public:
+		// Chunks start from {initSize} bytes and grow
+		// geometrically
+		explicit MonotonicArena(size_t initSize = 4096) noexcept :
+			_chunks(nullptr),
+			_cur(nullptr),
+			_end(nullptr),
+			_buffer(nullptr),
+			_bufferSize(0),
+			_initSize(initSize ? initSize : 4096),
+			_nextSize(_initSize),
+			_used(0),
+			_reserved(0)
+		{}
+
+		// Serve from {buffer} of {size} bytes first, which
+		// is owned by caller and never freed by arena
+		MonotonicArena(void *buffer, size_t size) noexcept :
+			MonotonicArena(size)
+		{
+			_buffer = static_cast<char*>(buffer);
+			_bufferSize = size;
+			_cur = _buffer;
+			_end = _buffer + size;
+		}
+
+		MonotonicArena(const MonotonicArena &) = delete;
+		MonotonicArena& operator=(const MonotonicArena &) = delete;
+
+		~MonotonicArena()
+		{
+			release();
+		}
+
+		// Allocate {n} bytes aligned to {align}, which
+		// should be power of 2
+		void* allocate(size_t n, size_t align = alignof(std::max_align_t))
+		{
+			// Compare sizes rather than form p + n, 
+			// which may wrap around for huge {n}
+			auto p = _alignUp(_cur, align);
+			if (!_cur || p > _end || n > static_cast<size_t>(_end - p)) {
+				_grow(n, align);
+				p = _alignUp(_cur, align);
+			}
+
+			_cur = p + n;
+			_used += n;
+			return static_cast<void*>(p);
+		}
+
+		// Give all chunks back to system in one call,
+		// every object allocated from arena is gone
+		void release() noexcept
+		{
+			while (_chunks) {
+				auto next = _chunks->pNext;
+				baseAlloc::dealloc(_chunks, _chunks->size);
+				_chunks = next;
+			}
+
+			_cur = _buffer;
+			_end = _buffer ? _buffer + _bufferSize : nullptr;
+			_nextSize = _initSize;
+			_used = 0;
+			_reserved = 0;
+		}
+
+		// Bytes handed out since last release
+		size_t used() const noexcept
+		{
+			return _used;
+		}
+
+		// Bytes of chunks held by arena
+		size_t reserved() const noexcept
+		{
+			return _reserved;
+		}
+
+	private:
+		// Header of chunks fetched from system
+		struct _Chunk
+		{
+			_Chunk *pNext;
+			size_t size;
+		};
+
+		static char* _alignUp(char *p, size_t align) noexcept
+		{
+			auto addr = reinterpret_cast<size_t>(p);
+			return p + ((align - addr % align) % align);
+		}
+
+		// Fetch a new chunk holding at least {n} bytes
+		// aligned to {align}
+		void _grow(size_t n, size_t align)
+		{
+			if (n > static_cast<size_t>(-1) - sizeof(_Chunk) - align) {
+				throw std::bad_alloc();
+			}
+
+			// Chunk sizes stop doubling before they wrap
+			// around, then the chunk is as large as asked.
+			// Sizes are kept if the chunk can't be fetched
+			const size_t maxDouble = static_cast<size_t>(-1) / 2;
+			auto need = sizeof(_Chunk) + n + align;
+			auto size = _nextSize;
+			while (size < need && size <= maxDouble) {
+				size *= 2;
+			}
+			if (size < need) {
+				size = need;
+			}
+
+			auto chunk = static_cast<_Chunk*>(baseAlloc::alloc(size));
+			_nextSize = size <= maxDouble ? 2 * size : size;
+			chunk->pNext = _chunks;
+			chunk->size = size;
+			_chunks = chunk;
+			_reserved += size;
+
+			_cur = static_cast<char*>(static_cast<void*>(chunk)) + sizeof(_Chunk);
+			_end = static_cast<char*>(static_cast<void*>(chunk)) + size;
+		}
+
+		_Chunk *_chunks;
+		char *_cur;			// Start of free space in current chunk
+		char *_end;			// End of current chunk
+		char *_buffer;		// Initial buffer of user
+		size_t _bufferSize;
+		size_t _initSize;
+		size_t _nextSize;	// Size of next chunk
+		size_t _used;
+		size_t _reserved;
+	};
+
+	// Stateful allocator handle of a MonotonicArena.
+	// deallocate() is a no-op, memory goes back when
+	// the arena is released.
+	// Containers rebind it for their nodes, maps and
+	// buffers, so they all live in the same arena
+	template<typename T>
+	class ArenaAllocator {
+		static_assert(!isConst<T>::value,
+			"Const type is ill formed to be allocated");
+
+		template<typename U>
+		friend class ArenaAllocator;
+
+	public:
+		using ValueType = T;
+		using Pointer = T * ;
+		using ConstPointer = const T*;
+		using Reference = T & ;
+		using ConstReference = const T&;
+		using SizeType = size_t;
+		using DifferenceType = ptrdiff_t;
+		using IsBulkReleased = trueType;
+
+		// Constructor
+		explicit ArenaAllocator(MonotonicArena &arena) noexcept :
+			_arena(MSTD::addressof(arena))
+		{}
+
+		ArenaAllocator(const ArenaAllocator &) = default;
+
+		// Rebound from allocator of another type
+		template<typename U>
+		ArenaAllocator(const ArenaAllocator<U> &that) noexcept :
+			_arena(that._arena)
+		{}
+
+		Pointer address(Reference lvalue) const noexcept { return MSTD::addressof(lvalue); }
+		ConstPointer address(ConstReference lvalue) const noexcept { return MSTD::addressof(lvalue); }
+
+		T* allocate(SizeType n)
+		{
+			return static_cast<T*>(_arena->allocate(n * sizeof(T), alignof(T)));
+		}
+
+		void deallocate(Pointer, SizeType) noexcept
+		{
+			// no-op
+		}
+
+		constexpr SizeType maxSize() const noexcept
+		{
+			return static_cast<SizeType>(-1) / sizeof(T);
+		}
+
+		template<typename U, typename... Args>
+		void construct(U *p, Args&&... args)
+		{
+			::new ((void*)p) U(MSTD::forward<Args>(args)...);
+		}
+
+		template<typename U>
+		void destroy(U *p)
+		{
+			p->~U();
+		}
+
+		MonotonicArena* arena() const noexcept
+		{
+			return _arena;
+		}
+
+	private:
+		MonotonicArena *_arena;
+	};
+
+	// Allocators are equal if they share an arena
+	template<typename T, typename U>
+	inline
+	bool operator==(const ArenaAllocator<T> &lhs, const ArenaAllocator<U> &rhs) noexcept
+	{
+		return lhs.arena() == rhs.arena();
+	}
+
+	template<typename T, typename U>
+	inline
+	bool operator!=(const ArenaAllocator<T> &lhs, const ArenaAllocator<U> &rhs) noexcept
+	{
+		return !(lhs == rhs);
+	}
+}
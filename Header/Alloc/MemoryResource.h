@@ -0,0 +1,296 @@
+#pragma once
+
+// Memory resource header
+// Allocation backends chosen at runtime, shared by
+// containers through PolymorphicAllocator
+
+#include <Alloc/Allocator.h>
+#include <Alloc/ArenaAllocator.h>
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+namespace MSTD {
+
+	// Interface of memory backends.
+	// Memory from a resource is given back to the same
+	// one with the size and alignment it was asked for
+	class MemoryResource
+	{
+	public:
+		virtual ~MemoryResource() = default;
+
+		// Allocate {bytes} aligned to {align}, which should
+		// be power of 2 no larger than _MAX_ALIGN
+		void* allocate(size_t bytes, size_t align = alignof(std::max_align_t))
+		{
+			return doAllocate(bytes, align);
+		}
+
+		void deallocate(void *p, size_t bytes, size_t align = alignof(std::max_align_t))
+		{
+			doDeallocate(p, bytes, align);
+		}
+
+		// Memory from one resource can be given back to
+		// the other one
+		bool isEqual(const MemoryResource &that) const noexcept
+		{
+			return doIsEqual(that);
+		}
+
+	protected:
+		virtual void* doAllocate(size_t bytes, size_t align) = 0;
+		virtual void doDeallocate(void *p, size_t bytes, size_t align) = 0;
+		virtual bool doIsEqual(const MemoryResource &that) const noexcept = 0;
+	};
+
+	inline
+	bool operator==(const MemoryResource &lhs, const MemoryResource &rhs) noexcept
+	{
+		return &lhs == &rhs || lhs.isEqual(rhs);
+	}
+
+	inline
+	bool operator!=(const MemoryResource &lhs, const MemoryResource &rhs) noexcept
+	{
+		return !(lhs == rhs);
+	}
+
+	// Resource of global operator new and delete
+	class NewDeleteResource : public MemoryResource
+	{
+	protected:
+		void* doAllocate(size_t bytes, size_t align) override
+		{
+			if (align <= alignof(std::max_align_t)) {
+				return ::operator new(bytes);
+			}
+			return _alignBlock(::operator new(_alignedRequest(bytes, align)), align);
+		}
+
+		void doDeallocate(void *p, size_t, size_t align) override
+		{
+			if (align <= alignof(std::max_align_t)) {
+				::operator delete(p);
+			}
+			else {
+				::operator delete(_baseOfAligned(p));
+			}
+		}
+
+		bool doIsEqual(const MemoryResource &that) const noexcept override
+		{
+			return dynamic_cast<const NewDeleteResource*>(&that) != nullptr;
+		}
+	};
+
+	// Resource of the memory pool, i.e. defaultAlloc
+	class PoolResource : public MemoryResource
+	{
+	protected:
+		void* doAllocate(size_t bytes, size_t align) override
+		{
+			return defaultAlloc::allocAligned(bytes, align);
+		}
+
+		void doDeallocate(void *p, size_t bytes, size_t align) override
+		{
+			defaultAlloc::deallocAligned(p, bytes, align);
+		}
+
+		bool doIsEqual(const MemoryResource &that) const noexcept override
+		{
+			return dynamic_cast<const PoolResource*>(&that) != nullptr;
+		}
+	};
+
+	// Resource of a MonotonicArena owned by itself.
+	// deallocate() is a no-op, all memory goes back by
+	// release() or when the resource is destroyed.
+	// Not thread safe
+	class MonotonicResource : public MemoryResource
+	{
+	public:
+		explicit MonotonicResource(size_t initSize = 4096) noexcept :
+			_arena(initSize)
+		{}
+
+		// Serve from {buffer} of {size} bytes first, which
+		// is owned by caller
+		MonotonicResource(void *buffer, size_t size) noexcept :
+			_arena(buffer, size)
+		{}
+
+		MonotonicResource(const MonotonicResource &) = delete;
+		MonotonicResource& operator=(const MonotonicResource &) = delete;
+
+		void release() noexcept
+		{
+			_arena.release();
+		}
+
+		MonotonicArena& arena() noexcept
+		{
+			return _arena;
+		}
+
+	protected:
+		void* doAllocate(size_t bytes, size_t align) override
+		{
+			return _arena.allocate(bytes, align);
+		}
+
+		void doDeallocate(void*, size_t, size_t) override
+		{
+			// no-op
+		}
+
+		bool doIsEqual(const MemoryResource &that) const noexcept override
+		{
+			return this == &that;
+		}
+
+	private:
+		MonotonicArena _arena;
+	};
+
+	inline MemoryResource* newDeleteResource() noexcept
+	{
+		static NewDeleteResource resource;
+		return &resource;
+	}
+
+	inline MemoryResource* poolResource() noexcept
+	{
+		static PoolResource resource;
+		return &resource;
+	}
+
+	inline std::atomic<MemoryResource*>& _defaultResourceRef() noexcept
+	{
+#ifdef USE_DIRECT_MALLOC
+		static std::atomic<MemoryResource*> resource{ newDeleteResource() };
+#else
+		static std::atomic<MemoryResource*> resource{ poolResource() };
+#endif // USE_DIRECT_MALLOC
+		return resource;
+	}
+
+	// Resource of PolymorphicAllocator constructed without
+	// one, the pool by default
+	inline MemoryResource* defaultResource() noexcept
+	{
+		return _defaultResourceRef().load(std::memory_order_acquire);
+	}
+
+	// Replace the default resource with {resource}, or
+	// the initial one if it is null, and return the old one.
+	// Allocators constructed before keep their resource
+	inline MemoryResource* setDefaultResource(MemoryResource *resource) noexcept
+	{
+		if (!resource) {
+#ifdef USE_DIRECT_MALLOC
+			resource = newDeleteResource();
+#else
+			resource = poolResource();
+#endif // USE_DIRECT_MALLOC
+		}
+		return _defaultResourceRef().exchange(resource, std::memory_order_acq_rel);
+	}
+
+	// Allocator handle of a MemoryResource.
+	// Containers of the same type can live on different
+	// backends, which is chosen when they are constructed.
+	// Containers rebind it for their nodes, maps and buffers,
+	// so they all share the resource. Nested containers don't
+	// inherit it, they take the default resource unless one
+	// is passed to them
+	template<typename T>
+	class PolymorphicAllocator {
+		static_assert(!isConst<T>::value,
+			"Const type is ill formed to be allocated");
+		static_assert(alignof(T) <= _MAX_ALIGN,
+			"Alignment larger than a page isn't supported");
+
+	public:
+		using ValueType = T;
+		using Pointer = T * ;
+		using ConstPointer = const T*;
+		using Reference = T & ;
+		using ConstReference = const T&;
+		using SizeType = size_t;
+		using DifferenceType = ptrdiff_t;
+
+		// Constructor
+		PolymorphicAllocator() noexcept :
+			_resource(defaultResource())
+		{}
+
+		PolymorphicAllocator(MemoryResource *resource) noexcept :
+			_resource(resource)
+		{}
+
+		PolymorphicAllocator(const PolymorphicAllocator &) = default;
+
+		// Rebound from allocator of another type
+		template<typename U>
+		PolymorphicAllocator(const PolymorphicAllocator<U> &that) noexcept :
+			_resource(that.resource())
+		{}
+
+		Pointer address(Reference lvalue) const noexcept { return MSTD::addressof(lvalue); }
+		ConstPointer address(ConstReference lvalue) const noexcept { return MSTD::addressof(lvalue); }
+
+		T* allocate(SizeType n)
+		{
+			return static_cast<T*>(_resource->allocate(n * sizeof(T), alignof(T)));
+		}
+
+		void deallocate(Pointer p, SizeType n)
+		{
+			_resource->deallocate(p, n * sizeof(T), alignof(T));
+		}
+
+		constexpr SizeType maxSize() const noexcept
+		{
+			return static_cast<SizeType>(-1) / sizeof(T);
+		}
+
+		template<typename U, typename... Args>
+		void construct(U *p, Args&&... args)
+		{
+			::new ((void*)p) U(MSTD::forward<Args>(args)...);
+		}
+
+		template<typename U>
+		void destroy(U *p)
+		{
+			p->~U();
+		}
+
+		MemoryResource* resource() const noexcept
+		{
+			return _resource;
+		}
+
+	private:
+		MemoryResource *_resource;
+	};
+
+	// Allocators are equal if memory of one resource
+	// can be given back to the other one
+	template<typename T, typename U>
+	inline
+	bool operator==(const PolymorphicAllocator<T> &lhs, const PolymorphicAllocator<U> &rhs) noexcept
+	{
+		return *lhs.resource() == *rhs.resource();
+	}
+
+	template<typename T, typename U>
+	inline
+	bool operator!=(const PolymorphicAllocator<T> &lhs, const PolymorphicAllocator<U> &rhs) noexcept
+	{
+		return !(lhs == rhs);
+	}
+}
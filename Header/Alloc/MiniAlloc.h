@@ -7,10 +7,195 @@
  *	Internal use
 */
 #include <new>
+#include <cstddef>
 #include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <mutex>
+#include <atomic>
+#include <Config/Config.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+	#include <sys/mman.h>
+	#define _POOL_USE_MMAP
+#endif
+
+#ifdef USE_ALLOC_STATS
+	#include <ostream>
+	#define _ALLOC_STAT(expr) expr
+#else
+	#define _ALLOC_STAT(expr)
+#endif // USE_ALLOC_STATS
+
+#ifdef USE_ALLOC_DEBUG
+	#include <cstdio>
+#endif // USE_ALLOC_DEBUG
 
 namespace MSTD {
 
+#ifdef USE_ALLOC_STATS
+	// ================= _StatCounter =================
+
+	// Event counters of allocators, only updated 
+	// if USE_ALLOC_STATS is defined
+	template<int hint>
+	struct _StatCounter
+	{
+		// Bytes of pooled blocks held by clients
+		static std::atomic<size_t> inUse;
+
+		// Batches fetched from central pool
+		static std::atomic<size_t> refills;
+
+		// Chunks fetched from system
+		static std::atomic<size_t> chunkFetches;
+
+		// Requests delegated to baseAlloc
+		static std::atomic<size_t> fallbacks;
+
+		// Invocations of omHandle
+		static std::atomic<size_t> omHandles;
+	};
+
+	template<int hint>
+	std::atomic<size_t> _StatCounter<hint>::inUse(0);
+
+	template<int hint>
+	std::atomic<size_t> _StatCounter<hint>::refills(0);
+
+	template<int hint>
+	std::atomic<size_t> _StatCounter<hint>::chunkFetches(0);
+
+	template<int hint>
+	std::atomic<size_t> _StatCounter<hint>::fallbacks(0);
+
+	template<int hint>
+	std::atomic<size_t> _StatCounter<hint>::omHandles(0);
+
+	struct AllocStats;
+#endif // USE_ALLOC_STATS
+
+	// ================= ChunkProvider ================
+
+	// Source of heap space of memory pool.
+	// Pool asks for chunks in multiples of {granularity}
+	// bytes, {alloc} returns nullptr on failure and 
+	// {dealloc} takes back a whole chunk
+	struct ChunkProvider
+	{
+		void* (*alloc)(size_t n);
+		void (*dealloc)(void *p, size_t n);
+		size_t granularity;
+	};
+
+	// Size and alignment of a transparent huge page
+	constexpr size_t _HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+	inline void* _mallocChunk(size_t n)
+	{
+		return malloc(n);
+	}
+
+	inline void _freeChunk(void *p, size_t)
+	{
+		free(p);
+	}
+
+	inline void* _mapChunk(size_t n)
+	{
+#ifdef _POOL_USE_MMAP
+		// Map one more huge page so the region can 
+		// be aligned, then unmap the unaligned ends
+		size_t len = n + _HUGE_PAGE_SIZE;
+		void *p = mmap(nullptr, len, PROT_READ | PROT_WRITE, 
+						MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (p == MAP_FAILED) {
+			return nullptr;
+		}
+
+		auto start = static_cast<char*>(p);
+		auto addr = reinterpret_cast<uintptr_t>(start);
+		auto aligned = start + (((addr + _HUGE_PAGE_SIZE - 1) & ~(_HUGE_PAGE_SIZE - 1)) - addr);
+		if (aligned != start) {
+			munmap(start, aligned - start);
+		}
+		if (start + len != aligned + n) {
+			munmap(aligned + n, start + len - (aligned + n));
+		}
+
+#ifdef MADV_HUGEPAGE
+		// Only a hint, the region is backed by normal
+		// pages if transparent huge pages are disabled
+		madvise(aligned, n, MADV_HUGEPAGE);
+#endif // MADV_HUGEPAGE
+		return aligned;
+#else
+		return malloc(n);
+#endif // _POOL_USE_MMAP
+	}
+
+	inline void _unmapChunk(void *p, size_t n)
+	{
+#ifdef _POOL_USE_MMAP
+		munmap(p, n);
+#else
+		(void)n;
+		free(p);
+#endif // _POOL_USE_MMAP
+	}
+
+	// Chunks from malloc, used by default
+	inline const ChunkProvider& mallocChunkProvider()
+	{
+		static const ChunkProvider provider = { _mallocChunk, _freeChunk, 4096 };
+		return provider;
+	}
+
+	// Chunks mapped from system in multiples of huge 
+	// page size and aligned to it, so that they can be
+	// backed by transparent huge pages and trees of 
+	// millions of nodes suffer fewer TLB misses.
+	// Same as malloc chunks on systems without mmap
+	inline const ChunkProvider& hugePageChunkProvider()
+	{
+		static const ChunkProvider provider = { _mapChunk, _unmapChunk, _HUGE_PAGE_SIZE };
+		return provider;
+	}
+
+	// ================= Alignment ================
+
+	// Size of a cache line, blocks shared across threads
+	// are aligned to it to avoid false sharing
+	constexpr size_t _CACHE_LINE_SIZE = 64;
+
+	// Largest alignment supported, a page
+	constexpr size_t _MAX_ALIGN = 4096;
+
+	// Over-aligned block is cut from a larger one of 
+	// this size, with room for the address of the 
+	// larger one right before it
+	inline size_t _alignedRequest(size_t n, size_t align) noexcept
+	{
+		return n + align;
+	}
+
+	// Cut block aligned to {align} from {base}, which
+	// is pointer aligned
+	inline void* _alignBlock(void *base, size_t align) noexcept
+	{
+		auto addr = reinterpret_cast<uintptr_t>(base) + sizeof(void*);
+		addr = (addr + align - 1) & ~static_cast<uintptr_t>(align - 1);
+		auto ret = reinterpret_cast<void*>(addr);
+		static_cast<void**>(ret)[-1] = base;
+		return ret;
+	}
+
+	// Larger block that over-aligned {p} is cut from
+	inline void* _baseOfAligned(void *p) noexcept
+	{
+		return static_cast<void**>(p)[-1];
+	}
+
 	// ================= _DirectMalloc ================
 
 	using AllocHandle = void(*)();
@@ -28,6 +213,9 @@ namespace MSTD {
 		static AllocHandle setAllocHandle(AllocHandle pHandle);
 
 	public:
+		// Blocks are always aligned to it
+		static constexpr size_t _NATURAL_ALIGN = alignof(std::max_align_t);
+
 		// Allocate {n} bytes for client
 		static void* alloc(size_t n)
 		{
@@ -44,6 +232,111 @@ namespace MSTD {
 		{
 			free(p);
 		}
+
+		// Bytes usable in a block of {n} bytes
+		static size_t goodSize(size_t n) noexcept
+		{
+			return n;
+		}
+
+		// Blocks of malloc are kept in place only when they
+		// shrink, they can't grow without being moved
+		static bool tryExpandInPlace(void *, size_t n, size_t newSize) noexcept
+		{
+			return newSize <= n;
+		}
+
+		// Resize block {p} of {n} bytes to {newSize} bytes,
+		// its bytes are kept and it may be moved. Large
+		// blocks are mapped by malloc of glibc and moved 
+		// by mremap, without copying any page
+		static void* reallocate(void *p, size_t n, size_t newSize)
+		{
+			if (!p || newSize == 0) {
+				dealloc(p, n);
+				return alloc(newSize);
+			}
+
+			auto ret = realloc(p, newSize);
+			if (!ret) {
+				// {p} is still valid
+				ret = omHandle(newSize);
+				std::memcpy(ret, p, n < newSize ? n : newSize);
+				free(p);
+			}
+			return ret;
+		}
+
+		// Allocate {n} bytes aligned to {align}, a power
+		// of 2 no larger than _MAX_ALIGN
+		static void* allocAligned(size_t n, size_t align)
+		{
+			if (align <= _NATURAL_ALIGN) {
+				return alloc(n);
+			}
+			return _alignBlock(alloc(_alignedRequest(n, align)), align);
+		}
+
+		// Deallocate {p} from allocAligned
+		static void deallocAligned(void *p, size_t n, size_t align)
+		{
+			if (align <= _NATURAL_ALIGN) {
+				dealloc(p, n);
+			}
+			else if (p) {
+				dealloc(_baseOfAligned(p), _alignedRequest(n, align));
+			}
+		}
+
+		// Allocate {count} blocks of {n} bytes linked
+		// through their first word, null terminated
+		static void* allocBatch(size_t n, size_t count)
+		{
+			void *first = nullptr;
+			size_t got = 0;
+			_MSTD_TRY
+				for (; got < count; ++got) {
+					auto p = alloc(n);
+					*static_cast<void**>(p) = first;
+					first = p;
+				}
+			_MSTD_CATCH_ALL
+				deallocBatch(first, n, got);
+				throw;
+			_MSTD_END_CATCH
+			return first;
+		}
+
+		// Deallocate {count} blocks of {n} bytes linked
+		// like a batch
+		static void deallocBatch(void *first, size_t, size_t count)
+		{
+			for (; count > 0; --count) {
+				auto next = *static_cast<void**>(first);
+				free(first);
+				first = next;
+			}
+		}
+
+		// Nothing is cached, so nothing to release
+		static size_t trim()
+		{
+			return 0;
+		}
+
+		static void setTrimThreshold(size_t) { }
+
+		// No memory pool behind, keep the same one
+		static const ChunkProvider& setChunkProvider(const ChunkProvider &)
+		{
+			return mallocChunkProvider();
+		}
+
+#ifdef USE_ALLOC_STATS
+		static AllocStats stats();
+
+		static void dumpStats(std::ostream &os);
+#endif // USE_ALLOC_STATS
 	};
 
 	template<int hint>
@@ -52,6 +345,7 @@ namespace MSTD {
 	template<int hint>
 	void* _DirectMalloc<hint>::omHandle(size_t n)
 	{
+		_ALLOC_STAT(_StatCounter<hint>::omHandles.fetch_add(1, std::memory_order_relaxed));
 		while (true) {
 			if (_allocHandle) {
 				_allocHandle();
@@ -78,7 +372,13 @@ namespace MSTD {
 	// Explicit instance
 	using baseAlloc = _DirectMalloc<0>;
 
-	// ================= _DefaultMalloc =================
+	// ================= _CentralPool =================
+
+	// Upper bound of requests served by memory pool,
+	// it can be lowered to any multiple of 8 up to 32768
+#ifndef POOL_MAX_ALLOC
+	#define POOL_MAX_ALLOC 32768
+#endif
 
 	// Definition of memory block
 	union _Block
@@ -87,145 +387,351 @@ namespace MSTD {
 		void *used;
 	};
 
-	// Sub allocator
-	// Use free list to manage memory pool
-	template<int hint>
-	class _DefaultMalloc {
+	// Heap space fetched from system
+	struct _Chunk
+	{
+		char *start;
+		size_t size;
+		size_t used;	// Bytes handed out to thread caches
+		const ChunkProvider *provider;	// Where it comes from
+	};
 
+	// Memory pool shared by all threads.
+	// Use free list to manage memory pool and
+	// hand out blocks in batches to thread caches.
+	// Every operation is guarded by {_mutex}
+	//
+	// Requests are rounded up to a size class:
+	//  * (0, 128]     : multiples of 8 bytes
+	//  * (128, 32768] : 4 classes between two powers of 2
+	// So a block wastes at most 7 bytes below 128 bytes
+	// and less than 1/5 of itself above.
+	// Blocks of one class are carved from a slab, a run of
+	// whole pages cut from heap space and dedicated to 
+	// that class.
+	template<int hint>
+	class _CentralPool {
+	public:
 		// Minimun block size in memory pool
 		static constexpr size_t _BLOCK_SIZE = 8;
 
+		// Largest size class with 8-byte spacing
+		static constexpr size_t _SMALL_SHIFT = 7;
+		static constexpr size_t _SMALL_MAX = size_t(1) << _SMALL_SHIFT;
+		static constexpr size_t _SMALL_SLOTS = _SMALL_MAX / _BLOCK_SIZE;
+
+		// log2 of number of classes between two powers of 2
+		static constexpr size_t _GROUP_SHIFT = 2;
+
 		// Number of slots 
-		static constexpr size_t _TABLE_SIZE = 16;
+		static constexpr size_t _TABLE_SIZE = _SMALL_SLOTS + (8 << _GROUP_SHIFT);
 
 		// Threshhold of block size.
 		// if memory request exceeds this limit,
 		// allocator will delegate allocation task to
 		// baseAlloc
-		static constexpr size_t _MAX_ALLOC = 128;
+		static constexpr size_t _MAX_ALLOC = POOL_MAX_ALLOC;
 
-		// Free list table
-		static _Block *_freeList[_TABLE_SIZE];
+		static_assert(_MAX_ALLOC % _BLOCK_SIZE == 0 && _MAX_ALLOC <= 32768, 
+			"POOL_MAX_ALLOC should be a multiple of 8 and no larger than 32768");
 
-		// Total size of allocated heap
-		static size_t _heapSize;
+		// Slabs are made up of pages of this size
+		static constexpr size_t _PAGE_SIZE = 4096;
 
-		// Start of available memory
-		static char* _freeStart;
+		// Bytes moved between central pool and a thread
+		// cache at a time are at most about this size
+		static constexpr size_t _BATCH_BYTES = 64 * 1024;
 
-		// End of available memory
-		static char* _freeEnd;
+		// Bounds of number of blocks moved at a time
+		static constexpr size_t _MIN_BATCH = 2;
+		static constexpr size_t _MAX_BATCH = 128;
 
 		static size_t roundUp(size_t n) noexcept
 		{
-			return (n + _BLOCK_SIZE - 1) & ~(_BLOCK_SIZE - 1);
+			return classSize(index(n));
 		}
 
+		// Slot of size class {n} belongs to
 		static size_t index(size_t n) noexcept
 		{
-			return (n + _BLOCK_SIZE - 1) / _BLOCK_SIZE - 1;
-		}
-
-		// Generate new blocks that can contain n bytes 
-		// at least assume that {n} has been rounded up to 
-		// power of 2.
-		// Return the pointer of first free block to client
-		static void* refill(size_t n);
+			if (n <= _SMALL_MAX) {
+				return (n + _BLOCK_SIZE - 1) / _BLOCK_SIZE - 1;
+			}
 
-		// Request for {nBlock} memory blocks of size {n}
-		// it's assumed that {n} has been rounded up to 
-		// power of 2.
-		// Return the pointer of first free block
-		static void* fetchMemory(size_t n, size_t &nBlock);
+			// 2^shift < n <= 2^(shift + 1)
+			size_t shift = _floorLog2(n - 1);
+			return _SMALL_SLOTS + ((shift - _SMALL_SHIFT) << _GROUP_SHIFT) + 
+				((n - 1 - (size_t(1) << shift)) >> (shift - _GROUP_SHIFT));
+		}
 
-	public:
-		static void* alloc(size_t n)
+		// Block size of slot {idx}
+		static size_t classSize(size_t idx) noexcept
 		{
-			if (n > _MAX_ALLOC || n == 0) {
-				return baseAlloc::alloc(n);
+			if (idx < _SMALL_SLOTS) {
+				return (idx + 1) * _BLOCK_SIZE;
 			}
 
-			auto pBlock = _freeList[index(n)];
-			if (!pBlock) { // blocks of size {n} have been used up
-				return refill(roundUp(n));
-			}
+			idx -= _SMALL_SLOTS;
+			size_t shift = _SMALL_SHIFT + (idx >> _GROUP_SHIFT);
+			size_t step = size_t(1) << (shift - _GROUP_SHIFT);
+			return (size_t(1) << shift) + ((idx & ((size_t(1) << _GROUP_SHIFT) - 1)) + 1) * step;
+		}
 
-			// Pick out first block of this slot
-			_freeList[index(n)] = pBlock->pNext;
-			return static_cast<void*>(pBlock);
+		// Most blocks moved at a time for slot {idx},
+		// fewer for larger blocks
+		static size_t batchSize(size_t idx) noexcept
+		{
+			size_t count = _BATCH_BYTES / classSize(idx);
+			return count < _MIN_BATCH ? _MIN_BATCH : (count > _MAX_BATCH ? _MAX_BATCH : count);
 		}
 
-		static void dealloc(void *p, size_t n)
+		// Bytes of a slab of slot {idx}, a batch of
+		// blocks at least
+		static size_t slabSize(size_t idx) noexcept
 		{
-			if (n > _MAX_ALLOC || n == 0) {
-				baseAlloc::dealloc(p, n);
-				return;
-			}
+			size_t bytes = classSize(idx) * batchSize(idx);
+			return (bytes + _PAGE_SIZE - 1) & ~(_PAGE_SIZE - 1);
+		}
 
-			// Put back into memory pool.
-			// Insert it into the head 
-			// of queue
-			if (p) {
-				auto pBlock = static_cast<_Block *>(p);
-				pBlock->pNext = _freeList[index(n)];
-				_freeList[index(n)] = pBlock;
+		// Hand out at most {nBlock} blocks of slot {idx} 
+		// as a null-terminated list.
+		// {nBlock} is set to the number of blocks actually
+		// handed out
+		static _Block* fetchBatch(size_t idx, size_t &nBlock);
+
+		// Take back the linked blocks [first, last] of 
+		// slot {idx}
+		static void releaseBatch(size_t idx, _Block *first, _Block *last);
+
+		// Give chunks none of whose blocks are handed out
+		// back to system.
+		// Return the number of bytes released
+		static size_t trim();
+
+		// Once bytes of idle chunks exceed {bytes}, they
+		// are released automatically.
+		// Disabled by default
+		static void setTrimThreshold(size_t bytes);
+
+		// Fetch later chunks from {provider}, chunks 
+		// fetched before are still given back to where
+		// they come from.
+		// Return the previous provider
+		static const ChunkProvider& setChunkProvider(const ChunkProvider &provider);
+
+#ifdef USE_ALLOC_STATS
+		// Fill in fields of {st} owned by central pool
+		static void collect(AllocStats &st);
+#endif // USE_ALLOC_STATS
+
+	private:
+		// Lock of the whole pool
+		static std::mutex _mutex;
+
+		// Free list table
+		static _Block *_freeList[_TABLE_SIZE];
+
+		// Uncarved part of the current slab of each slot
+		static char *_slabStart[_TABLE_SIZE];
+		static char *_slabEnd[_TABLE_SIZE];
+
+		// Total size of allocated heap
+		static size_t _heapSize;
+
+		// Start of available memory
+		static char* _freeStart;
+
+		// End of available memory
+		static char* _freeEnd;
+
+		// Chunks sorted by address
+		static _Chunk *_chunks;
+		static size_t _chunkCnt;
+		static size_t _chunkCap;
+
+		// Total size of chunks with no blocks handed out
+		static size_t _idleSize;
+
+		static size_t _trimThreshold;
+
+		// Source of new chunks, malloc if null
+		static const ChunkProvider *_provider;
+
+		static size_t _floorLog2(size_t n) noexcept
+		{
+#if defined(__GNUC__)
+			return sizeof(unsigned long) * 8 - 1 - __builtin_clzl(n);
+#else
+			size_t ret = 0;
+			while (n >>= 1) {
+				++ret;
 			}
+			return ret;
+#endif
 		}
+
+		// Request for {nBlock} memory blocks of slot {idx}.
+		// Return the pointer of first free block
+		static void* fetchMemory(size_t idx, size_t &nBlock);
+
+		// Cut a new slab for slot {idx} from heap space
+		static void cutSlab(size_t idx);
+
+		// Apply for new heap space, at least one block
+		// of slot {idx}
+		static void fetchHeap(size_t idx);
+
+		// Split spare memory [start, end) into blocks 
+		// as large as possible and put them into free 
+		// list table
+		static void recycle(char *start, char *end);
+
+		// Record a chunk of {n} bytes starting at {p}
+		// fetched from {provider}
+		static void addChunk(char *p, size_t n, const ChunkProvider &provider);
+
+		// Chunk where {p} lies in
+		static _Chunk* findChunk(const void *p);
+
+		// Update usage of chunks for blocks [first, last] 
+		// of size {n} handed out or taken back
+		static void markUsage(_Block *first, _Block *last, size_t n, bool handOut);
+
+		// Do trim, {_mutex} is held by caller
+		static size_t trimLocked();
 	};
 
+	template<int hint>
+	std::mutex _CentralPool<hint>::_mutex;
+
 	// Initialize every slot to null
 	template<int hint>
-	_Block* _DefaultMalloc<hint>::_freeList[_TABLE_SIZE] = {
-			nullptr, nullptr, nullptr, nullptr,
-			nullptr, nullptr, nullptr, nullptr,
-			nullptr, nullptr, nullptr, nullptr,
-			nullptr, nullptr, nullptr, nullptr
-	};
+	_Block* _CentralPool<hint>::_freeList[_TABLE_SIZE] = {};
+
+	template<int hint>
+	char* _CentralPool<hint>::_slabStart[_TABLE_SIZE] = {};
+
+	template<int hint>
+	char* _CentralPool<hint>::_slabEnd[_TABLE_SIZE] = {};
+
+	template<int hint>
+	size_t _CentralPool<hint>::_heapSize = 0;
+
+	template<int hint>
+	char* _CentralPool<hint>::_freeStart = nullptr;
+
+	template<int hint>
+	char* _CentralPool<hint>::_freeEnd = nullptr;
+
+	template<int hint>
+	_Chunk* _CentralPool<hint>::_chunks = nullptr;
+
+	template<int hint>
+	size_t _CentralPool<hint>::_chunkCnt = 0;
+
+	template<int hint>
+	size_t _CentralPool<hint>::_chunkCap = 0;
 
 	template<int hint>
-	size_t _DefaultMalloc<hint>::_heapSize = 0;
+	size_t _CentralPool<hint>::_idleSize = 0;
 
 	template<int hint>
-	char* _DefaultMalloc<hint>::_freeStart = nullptr;
+	size_t _CentralPool<hint>::_trimThreshold = static_cast<size_t>(-1);
 
 	template<int hint>
-	char* _DefaultMalloc<hint>::_freeEnd = nullptr;
+	const ChunkProvider* _CentralPool<hint>::_provider = nullptr;
 
 	template<int hint>
-	void* _DefaultMalloc<hint>::refill(size_t n)
+	_Block* _CentralPool<hint>::fetchBatch(size_t idx, size_t &nBlock)
 	{
-		//Default request 20 blocks
-		size_t nBlock = 20;
+		std::lock_guard<std::mutex> lock(_mutex);
+		_ALLOC_STAT(_StatCounter<hint>::refills.fetch_add(1, std::memory_order_relaxed));
 
-		auto pFree = fetchMemory(n, nBlock);
+		// Reuse recycled blocks first
+		auto &slot = _freeList[idx];
+		if (slot) {
+			_Block *first = slot;
+			_Block *last = slot;
+			size_t count = 1;
+			while (count < nBlock && last->pNext) {
+				last = last->pNext;
+				++count;
+			}
+			slot = last->pNext;
+			last->pNext = nullptr;
+			nBlock = count;
+			markUsage(first, last, classSize(idx), true);
 
-		// Pick out the first block 
-		// and return it back to
-		// client
+			return first;
+		}
+
+		auto pFree = fetchMemory(idx, nBlock);
 
 		// Construct free Block list
+		size_t n = classSize(idx);
 		char *beg = static_cast<char*>(pFree);
-		_freeList[index(n)] = nBlock == 1 ? 
-			nullptr : static_cast<_Block*>(static_cast<void*>(beg + n));
-		// Start from i = 1 since the first block is 
-		// goning to be returned to client
-		for (size_t i = 1; i < nBlock; ++i) {
+		for (size_t i = 0; i < nBlock; ++i) {
 			auto current = static_cast<_Block*>(static_cast<void*>(beg + i * n));
 			if (i != nBlock - 1) {
 				current->pNext = static_cast<_Block*>(static_cast<void*>(beg + (i + 1) * n));
 			}
 			else {
 				current->pNext = nullptr;
+				markUsage(static_cast<_Block*>(pFree), current, n, true);
 			}
 		}
 
-		return pFree;
+		return static_cast<_Block*>(pFree);
+	}
+
+	template<int hint>
+	void _CentralPool<hint>::releaseBatch(size_t idx, _Block *first, _Block *last)
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		// Put back into memory pool.
+		// Insert it into the head 
+		// of queue
+		last->pNext = _freeList[idx];
+		_freeList[idx] = first;
+
+		markUsage(first, last, classSize(idx), false);
+		if (_idleSize > _trimThreshold) {
+			trimLocked();
+		}
+	}
+
+	template<int hint>
+	size_t _CentralPool<hint>::trim()
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		return trimLocked();
+	}
+
+	template<int hint>
+	void _CentralPool<hint>::setTrimThreshold(size_t bytes)
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_trimThreshold = bytes;
+		if (_idleSize > _trimThreshold) {
+			trimLocked();
+		}
+	}
+
+	template<int hint>
+	const ChunkProvider& _CentralPool<hint>::setChunkProvider(const ChunkProvider &provider)
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		auto &old = _provider ? *_provider : mallocChunkProvider();
+		_provider = &provider;
+		return old;
 	}
 
 	template<int hint>
-	void* _DefaultMalloc<hint>::fetchMemory(size_t n, size_t & nBlock)
+	void* _CentralPool<hint>::fetchMemory(size_t idx, size_t & nBlock)
 	{
-		auto memoryLeft = _freeEnd - _freeStart;
+		size_t n = classSize(idx);
+		auto memoryLeft = static_cast<size_t>(_slabEnd[idx] - _slabStart[idx]);
 
 		// Maximum number of blocks can be allocated
 		auto maxBlock = memoryLeft / n;
@@ -235,31 +741,59 @@ namespace MSTD {
 
 		if (actualBlock > 0) {
 			// Alloc success
-			void *ret = _freeStart;
-			_freeStart += n * actualBlock;
+			void *ret = _slabStart[idx];
+			_slabStart[idx] += n * actualBlock;
 			// Tell clients how many blocks we 
 			// give them actually.
 			nBlock = actualBlock;
 
 			return ret;
 		}
-		
-		// No more free heap space, so we 
-		// have to apply for it.
 
-		// Before apply for it, we should 
-		// make use of rest free memory.
-		// This is because we will have a
-		// new heap space.
-		if (memoryLeft > 0) {
-			auto newBlock = static_cast<_Block*>(static_cast<void*>(_freeStart));
-			newBlock->pNext = _freeList[index(memoryLeft)];
-			_freeList[index(memoryLeft)] = newBlock;
+		// Current slab is used up, so we 
+		// cut a new one and restart process
+		cutSlab(idx);
+		return fetchMemory(idx, nBlock);
+	}
+
+	template<int hint>
+	void _CentralPool<hint>::cutSlab(size_t idx)
+	{
+		// Tail of old slab is too small for this
+		// slot, make use of it in smaller ones
+		recycle(_slabStart[idx], _slabEnd[idx]);
+
+		if (static_cast<size_t>(_freeEnd - _freeStart) < classSize(idx)) {
+			// Before apply for new heap space, we
+			// should make use of rest free memory.
+			recycle(_freeStart, _freeEnd);
+			fetchHeap(idx);
+		}
+
+		// Heap space borrowed from a free block may be
+		// shorter than a slab, then take all of it
+		auto memoryLeft = static_cast<size_t>(_freeEnd - _freeStart);
+		auto slab = slabSize(idx);
+		if (slab > memoryLeft) {
+			slab = memoryLeft;
 		}
 
-		// Apply for new space
-		auto memoryRequest = 2 * (n * nBlock) + roundUp(_heapSize >> 4);
-		_freeStart = static_cast<char*>(malloc(memoryRequest));
+		_slabStart[idx] = _freeStart;
+		_slabEnd[idx] = _freeStart + slab;
+		_freeStart += slab;
+	}
+
+	template<int hint>
+	void _CentralPool<hint>::fetchHeap(size_t idx)
+	{
+		// Apply for new space, it's always made up 
+		// of whole pages so are slabs cut from it
+		auto provider = _provider ? _provider : &mallocChunkProvider();
+		auto memoryRequest = 2 * slabSize(idx) + 
+			((_heapSize >> 4) & ~(_PAGE_SIZE - 1));
+		auto unit = provider->granularity;
+		memoryRequest = (memoryRequest + unit - 1) / unit * unit;
+		_freeStart = static_cast<char*>(provider->alloc(memoryRequest));
 
 		// Once failed, we have to find some 
 		// spare space somewhere else
@@ -268,14 +802,15 @@ namespace MSTD {
 			// We need to solve it by ourself
 			// Solving it by borrowing blocks from 
 			// other larger free slot
-			for (size_t sz = n + _BLOCK_SIZE; sz <= _MAX_ALLOC; sz += _BLOCK_SIZE) {
-				auto pb = _freeList[index(sz)];
+			for (size_t i = idx + 1; i < _TABLE_SIZE; ++i) {
+				auto pb = _freeList[i];
 				if (pb) {
-					// Success, we will restart process
-					_freeList[index(sz)] = pb->pNext;
+					// Success, the block becomes 
+					// new heap space
+					_freeList[i] = pb->pNext;
 					_freeStart = static_cast<char*>(static_cast<void*>(pb));
-					_freeEnd = _freeStart + sz;
-					return fetchMemory(n, nBlock);
+					_freeEnd = _freeStart + classSize(i);
+					return;
 				}
 			}
 
@@ -284,15 +819,1317 @@ namespace MSTD {
 			// it useing alloc handle to
 			// get some memory.
 			_freeEnd = nullptr;
-			_freeStart = static_cast<char*>(baseAlloc::alloc(memoryRequest));
+			_freeStart = static_cast<char*>(_DirectMalloc<hint>::alloc(memoryRequest));
+			provider = &mallocChunkProvider();
+			_ALLOC_STAT(_StatCounter<hint>::fallbacks.fetch_add(1, std::memory_order_relaxed));
 		}
 
 		// Finally we got new free memory
+		_ALLOC_STAT(_StatCounter<hint>::chunkFetches.fetch_add(1, std::memory_order_relaxed));
 		_heapSize += memoryRequest;
 		_freeEnd = _freeStart + memoryRequest;
-		// Restart process to fetch memory
-		return fetchMemory(n, nBlock);
+		addChunk(_freeStart, memoryRequest, *provider);
+	}
+
+	template<int hint>
+	void _CentralPool<hint>::recycle(char *start, char *end)
+	{
+		auto memoryLeft = static_cast<size_t>(end - start);
+		while (memoryLeft >= _BLOCK_SIZE) {
+			// Largest size class fitting in
+			auto idx = index(memoryLeft > _MAX_ALLOC ? _MAX_ALLOC : memoryLeft);
+			if (classSize(idx) > memoryLeft) {
+				--idx;
+			}
+
+			auto newBlock = static_cast<_Block*>(static_cast<void*>(start));
+			newBlock->pNext = _freeList[idx];
+			_freeList[idx] = newBlock;
+			start += classSize(idx);
+			memoryLeft -= classSize(idx);
+		}
+	}
+
+	template<int hint>
+	void _CentralPool<hint>::addChunk(char *p, size_t n, const ChunkProvider &provider)
+	{
+		if (_chunkCnt == _chunkCap) {
+			// Chunk table is full, double it
+			auto newCap = _chunkCap ? 2 * _chunkCap : 16;
+			auto newChunks = static_cast<_Chunk*>(_DirectMalloc<hint>::alloc(newCap * sizeof(_Chunk)));
+			if (_chunks) {
+				std::memcpy(newChunks, _chunks, _chunkCnt * sizeof(_Chunk));
+				_DirectMalloc<hint>::dealloc(_chunks, _chunkCap * sizeof(_Chunk));
+			}
+			_chunks = newChunks;
+			_chunkCap = newCap;
+		}
+
+		// Keep chunks sorted
+		size_t pos = _chunkCnt;
+		while (pos > 0 && _chunks[pos - 1].start > p) {
+			_chunks[pos] = _chunks[pos - 1];
+			--pos;
+		}
+		_chunks[pos].start = p;
+		_chunks[pos].size = n;
+		_chunks[pos].used = 0;
+		_chunks[pos].provider = &provider;
+		++_chunkCnt;
+		_idleSize += n;
+	}
+
+	template<int hint>
+	_Chunk* _CentralPool<hint>::findChunk(const void *p)
+	{
+		// Binary search for the last chunk starting
+		// no later than {p}
+		auto addr = static_cast<const char*>(p);
+		size_t lo = 0, hi = _chunkCnt;
+		while (hi - lo > 1) {
+			auto mid = lo + (hi - lo) / 2;
+			if (_chunks[mid].start <= addr) {
+				lo = mid;
+			}
+			else {
+				hi = mid;
+			}
+		}
+		return _chunks + lo;
 	}
 
+	template<int hint>
+	void _CentralPool<hint>::markUsage(_Block *first, _Block *last, size_t n, bool handOut)
+	{
+		_Chunk *chunk = nullptr;
+		for (auto pb = first; ; pb = pb->pNext) {
+			// Blocks of a batch are mostly in the same chunk
+			auto addr = static_cast<char*>(static_cast<void*>(pb));
+			if (!chunk || addr < chunk->start || addr >= chunk->start + chunk->size) {
+				chunk = findChunk(addr);
+			}
+
+			if (handOut) {
+				if (chunk->used == 0) {
+					_idleSize -= chunk->size;
+				}
+				chunk->used += n;
+			}
+			else {
+				chunk->used -= n;
+				if (chunk->used == 0) {
+					_idleSize += chunk->size;
+				}
+			}
+
+			if (pb == last) {
+				break;
+			}
+		}
+	}
+
+	template<int hint>
+	size_t _CentralPool<hint>::trimLocked()
+	{
+		if (_idleSize == 0) {
+			return 0;
+		}
+
+		// Remove blocks of idle chunks from free lists
+		for (size_t idx = 0; idx < _TABLE_SIZE; ++idx) {
+			_Block **ppb = &_freeList[idx];
+			while (*ppb) {
+				if (findChunk(*ppb)->used == 0) {
+					*ppb = (*ppb)->pNext;
+				}
+				else {
+					ppb = &(*ppb)->pNext;
+				}
+			}
+
+			if (_slabStart[idx] != _slabEnd[idx] && findChunk(_slabStart[idx])->used == 0) {
+				_slabStart[idx] = _slabEnd[idx] = nullptr;
+			}
+		}
+		if (_freeStart != _freeEnd && findChunk(_freeStart)->used == 0) {
+			_freeStart = _freeEnd = nullptr;
+		}
+
+		// Release idle chunks and compact chunk table
+		size_t released = 0;
+		size_t cnt = 0;
+		for (size_t i = 0; i < _chunkCnt; ++i) {
+			if (_chunks[i].used == 0) {
+				released += _chunks[i].size;
+				_chunks[i].provider->dealloc(_chunks[i].start, _chunks[i].size);
+			}
+			else {
+				_chunks[cnt++] = _chunks[i];
+			}
+		}
+		_chunkCnt = cnt;
+		_heapSize -= released;
+		_idleSize = 0;
+
+		return released;
+	}
+
+#ifdef USE_ALLOC_STATS
+	// ================= AllocStats =================
+
+	// Snapshot of memory pool
+	struct AllocStats
+	{
+		static constexpr size_t _TABLE_SIZE = _CentralPool<0>::_TABLE_SIZE;
+
+		// Bytes reserved from system
+		size_t reserved;
+
+		// Number of chunks reserved
+		size_t chunks;
+
+		// Bytes of pooled blocks held by clients
+		size_t inUse;
+
+		// Bytes of blocks held by thread caches
+		size_t cached;
+
+		// Bytes of blocks waiting in remote lists
+		size_t remote;
+
+		// Free blocks in central pool per size class
+		size_t freeBlocks[_TABLE_SIZE];
+
+		// Batches fetched from central pool
+		size_t refills;
+
+		// Chunks fetched from system
+		size_t chunkFetches;
+
+		// Requests delegated to baseAlloc
+		size_t fallbacks;
+
+		// Invocations of omHandle
+		size_t omHandles;
+
+		void dump(std::ostream &os) const
+		{
+			os << "Memory pool statistics\n"
+				<< "  reserved      : " << reserved << " bytes in " << chunks << " chunks\n"
+				<< "  in use        : " << inUse << " bytes\n"
+				<< "  cached        : " << cached << " bytes\n"
+				<< "  remote        : " << remote << " bytes\n"
+				<< "  refills       : " << refills << '\n'
+				<< "  chunk fetches : " << chunkFetches << '\n'
+				<< "  fallbacks     : " << fallbacks << '\n'
+				<< "  omHandle calls: " << omHandles << '\n';
+
+			for (size_t idx = 0; idx < _TABLE_SIZE; ++idx) {
+				if (freeBlocks[idx] > 0) {
+					os << "  free blocks of " << _CentralPool<0>::classSize(idx)
+						<< " bytes: " << freeBlocks[idx] << '\n';
+				}
+			}
+			os.flush();
+		}
+	};
+
+	template<int hint>
+	void _CentralPool<hint>::collect(AllocStats &st)
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		st.reserved = _heapSize;
+		st.chunks = _chunkCnt;
+
+		// Blocks handed out are either held by 
+		// clients, cached by threads or in remote
+		// lists.
+		// {inUse} and {remote} are read without lock,
+		// so they may run ahead a little
+		size_t handedOut = 0;
+		for (size_t i = 0; i < _chunkCnt; ++i) {
+			handedOut += _chunks[i].used;
+		}
+		st.cached = handedOut > st.inUse + st.remote ? handedOut - st.inUse - st.remote : 0;
+
+		for (size_t idx = 0; idx < _TABLE_SIZE; ++idx) {
+			size_t count = 0;
+			for (auto pb = _freeList[idx]; pb; pb = pb->pNext) {
+				++count;
+			}
+			st.freeBlocks[idx] = count;
+		}
+	}
+
+	template<int hint>
+	AllocStats _DirectMalloc<hint>::stats()
+	{
+		// No memory pool behind
+		AllocStats st = {};
+		st.omHandles = _StatCounter<hint>::omHandles.load(std::memory_order_relaxed);
+		return st;
+	}
+
+	template<int hint>
+	void _DirectMalloc<hint>::dumpStats(std::ostream &os)
+	{
+		stats().dump(os);
+	}
+#endif // USE_ALLOC_STATS
+
+	// ================= _ThreadCache =================
+
+	// Per-thread front end of _CentralPool.
+	// Each thread owns a free list table, so alloc and
+	// dealloc never take a lock unless a slot runs dry
+	// or grows too long.
+	template<int hint>
+	class _ThreadCache {
+		using _Pool = _CentralPool<hint>;
+
+		enum _State
+		{
+			_UNREGISTERED,	// Exit hook of this thread isn't installed
+			_ACTIVE,		// Cache is in use
+			_RETIRED		// Thread is exiting, bypass the cache
+		};
+
+		// Return all cached blocks to central pool 
+		// when thread exits
+		struct _ExitHook
+		{
+			~_ExitHook() { _local._retire(); }
+		};
+
+		// Thread-local free list table
+		_Block *_freeList[_Pool::_TABLE_SIZE];
+
+		// Number of blocks in each slot
+		size_t _length[_Pool::_TABLE_SIZE];
+
+		// Blocks fetched by next refill of each slot.
+		// It starts from _MIN_BATCH on first use of the 
+		// slot and doubles on every refill up to 
+		// batchSize(), so a hot slot goes to central 
+		// pool less often. Once the slot overflows more
+		// than once since its last refill, it halves on
+		// every overflow, so blocks don't pile up in a
+		// cooling slot
+		size_t _batch[_Pool::_TABLE_SIZE];
+
+		// Once a slot holds more blocks than its limit,
+		// batchSize() blocks are given back to the 
+		// central pool, one refill batch is kept.
+		// Zero until first use of the slot
+		size_t _limit[_Pool::_TABLE_SIZE];
+
+		// Overflows of each slot since its last refill
+		size_t _overflows[_Pool::_TABLE_SIZE];
+
+		_State _state;
+
+		// Entry of this thread in owner table, 0 if it 
+		// has none
+		unsigned char _id;
+
+		// Zero initialized, no construction needed
+		static thread_local _ThreadCache _local;
+
+		// Remote lists of a thread, one per slot.
+		// Blocks allocated on one thread and freed on
+		// another, as in a producer/consumer pipeline,
+		// pile up in cache of the freeing thread. Once 
+		// the slot overflows they are pushed to remote 
+		// lists of their owner without lock, and the 
+		// owner takes all of them at once when its slot
+		// runs dry, before it turns to central pool.
+		// Chains are only pushed and the whole list is
+		// taken by exchange, so there's no ABA problem
+		struct _Owner
+		{
+			// Whether a thread holds this entry
+			std::atomic<bool> taken;
+
+			std::atomic<_Block*> remote[_Pool::_TABLE_SIZE];
+
+			// Blocks in each remote list, it's increased
+			// before blocks are pushed so never less than 
+			// the actual number
+			std::atomic<size_t> remoteCnt[_Pool::_TABLE_SIZE];
+		};
+
+		// Entry 0 stands for no owner. Threads beyond 
+		// the table don't own blocks, blocks they fetch 
+		// go back to central pool once freed elsewhere
+		static constexpr size_t _MAX_OWNERS = 64;
+
+		static _Owner _owners[_MAX_OWNERS];
+
+		// A remote list holds at most this many batches,
+		// further blocks go to central pool
+		static constexpr size_t _REMOTE_BATCHES = 8;
+
+		// Owner of each page of pooled memory, that is 
+		// the thread which fetched blocks in it from 
+		// central pool last. Blocks of a page may go to
+		// different threads, then the page follows the
+		// last one, so it's a hint of where blocks are
+		// wanted rather than a must.
+		// Page map is a two-level table indexed by page
+		// number, a leaf covers 2^_LEAF_BITS pages. 
+		// Leaves are allocated on first use and kept 
+		static constexpr size_t _PAGE_SHIFT = 12;
+		static constexpr size_t _LEAF_BITS = 20;
+		static constexpr size_t _ADDR_BITS = sizeof(void*) * 8 < 48 ? sizeof(void*) * 8 : 48;
+		static constexpr size_t _ROOT_SIZE = size_t(1) << (_ADDR_BITS - _PAGE_SHIFT - _LEAF_BITS);
+
+		static_assert(size_t(1) << _PAGE_SHIFT == _Pool::_PAGE_SIZE, 
+			"Page map doesn't match page size of central pool");
+
+		using _PageEntry = std::atomic<unsigned char>;
+
+		static std::atomic<_PageEntry*> _pageOwner[_ROOT_SIZE];
+
+	public:
+		// Allocate {n} bytes, {n} should be in range of
+		// (0, _MAX_ALLOC]
+		static void* alloc(size_t n)
+		{
+			auto &cache = _local;
+			auto idx = _Pool::index(n);
+			auto pBlock = cache._freeList[idx];
+			if (!pBlock) { // blocks of size {n} have been used up
+				return cache._refill(idx);
+			}
+
+			// Pick out first block of this slot
+			cache._freeList[idx] = pBlock->pNext;
+			--cache._length[idx];
+			return static_cast<void*>(pBlock);
+		}
+
+		// Deallocate {p} of {n} bytes, {n} should be in 
+		// range of (0, _MAX_ALLOC]
+		static void dealloc(void *p, size_t n)
+		{
+			auto &cache = _local;
+			if (cache._state != _ACTIVE) {
+				cache._deallocSlow(p, n);
+				return;
+			}
+
+			// Insert it into the head 
+			// of queue
+			auto idx = _Pool::index(n);
+			auto pBlock = static_cast<_Block *>(p);
+			pBlock->pNext = cache._freeList[idx];
+			cache._freeList[idx] = pBlock;
+			if (++cache._length[idx] > cache._limit[idx]) {
+				cache._overflow(idx);
+			}
+		}
+
+		// Allocate {count} blocks of {n} bytes as a 
+		// null-terminated list, {n} should be in range of
+		// (0, _MAX_ALLOC].
+		// Cached blocks are used first, the rest are 
+		// fetched from central pool a batch per lock
+		static _Block* allocBatch(size_t n, size_t count)
+		{
+			auto &cache = _local;
+			auto idx = _Pool::index(n);
+			_Block *first = nullptr;
+			size_t got = 0;
+			_MSTD_TRY
+				while (count - got > cache._length[idx]) {
+					size_t nBlock = count - got - cache._length[idx];
+					_Block *list = _Pool::fetchBatch(idx, nBlock);
+					cache._own(list);
+					_Block *last = list;
+					while (last->pNext) {
+						last = last->pNext;
+					}
+					last->pNext = first;
+					first = list;
+					got += nBlock;
+				}
+			_MSTD_CATCH_ALL
+				if (first) {
+					deallocBatch(first, n, got);
+				}
+				throw;
+			_MSTD_END_CATCH
+
+			// Take the rest from the local slot
+			size_t rest = count - got;
+			if (rest > 0) {
+				_Block *head = cache._freeList[idx];
+				_Block *last = head;
+				for (size_t i = 1; i < rest; ++i) {
+					last = last->pNext;
+				}
+				cache._freeList[idx] = last->pNext;
+				cache._length[idx] -= rest;
+				last->pNext = first;
+				first = head;
+			}
+			return first;
+		}
+
+		// Deallocate {count} blocks of {n} bytes linked 
+		// from {first}, {n} should be in range of 
+		// (0, _MAX_ALLOC]
+		static void deallocBatch(_Block *first, size_t n, size_t count)
+		{
+			auto &cache = _local;
+			auto idx = _Pool::index(n);
+			_Block *last = first;
+			for (size_t i = 1; i < count; ++i) {
+				last = last->pNext;
+			}
+
+			if (cache._state != _ACTIVE) {
+				if (cache._state == _RETIRED) {
+					_Pool::releaseBatch(idx, first, last);
+					return;
+				}
+				cache._register();
+			}
+			if (cache._limit[idx] == 0) {
+				cache._setBatch(idx, _Pool::_MIN_BATCH);
+			}
+
+			// Splice the whole list into local slot, then
+			// give back all but one batch at once if it 
+			// grows too long
+			last->pNext = cache._freeList[idx];
+			cache._freeList[idx] = first;
+			cache._length[idx] += count;
+			if (cache._length[idx] > cache._limit[idx]) {
+				cache._giveBack(idx, cache._length[idx] - cache._batch[idx]);
+			}
+		}
+
+		// Give all blocks cached by calling thread back to 
+		// central pool
+		static void flush()
+		{
+			auto &cache = _local;
+			for (size_t idx = 0; idx < _Pool::_TABLE_SIZE; ++idx) {
+				if (cache._length[idx] > 0) {
+					cache._release(idx, cache._length[idx]);
+				}
+			}
+		}
+
+		// Give all blocks in remote lists of every thread
+		// back to central pool
+		static void drainRemote()
+		{
+			for (size_t id = 1; id < _MAX_OWNERS; ++id) {
+				_drainOwner(_owners[id]);
+			}
+		}
+
+#ifdef USE_ALLOC_STATS
+		// Bytes of blocks in remote lists
+		static size_t remoteBytes()
+		{
+			size_t bytes = 0;
+			for (size_t id = 1; id < _MAX_OWNERS; ++id) {
+				for (size_t idx = 0; idx < _Pool::_TABLE_SIZE; ++idx) {
+					bytes += _owners[id].remoteCnt[idx].load(std::memory_order_relaxed) * 
+						_Pool::classSize(idx);
+				}
+			}
+			return bytes;
+		}
+#endif // USE_ALLOC_STATS
+
+	private:
+		// Install exit hook of current thread and take
+		// a free entry of owner table
+		void _register()
+		{
+			static thread_local _ExitHook hook;
+			(void)hook;
+			_state = _ACTIVE;
+
+			for (size_t id = 1; id < _MAX_OWNERS; ++id) {
+				auto &taken = _owners[id].taken;
+				if (!taken.load(std::memory_order_relaxed) && 
+					!taken.exchange(true, std::memory_order_acquire)) {
+					_id = static_cast<unsigned char>(id);
+					break;
+				}
+			}
+		}
+
+		// Refill batch of slot {idx} and limit of its 
+		// length
+		void _setBatch(size_t idx, size_t batch)
+		{
+			_batch[idx] = batch;
+			_limit[idx] = batch + _Pool::batchSize(idx);
+		}
+
+		// Fetch a batch of blocks of slot {idx} from central 
+		// pool and return the first one to client
+		void* _refill(size_t idx)
+		{
+			if (_state == _RETIRED) {
+				// No more caching on an exiting thread
+				size_t nBlock = 1;
+				return _Pool::fetchBatch(idx, nBlock);
+			}
+			if (_state == _UNREGISTERED) {
+				_register();
+			}
+
+			// Own blocks freed by other threads first
+			size_t nBlock;
+			_Block *last;
+			_Block *first = _id ? _takeRemote(_owners[_id], idx, nBlock, last) : nullptr;
+			if (!first) {
+				nBlock = _batch[idx] ? _batch[idx] : _Pool::_MIN_BATCH;
+				first = _Pool::fetchBatch(idx, nBlock);
+				_own(first);
+			}
+			_freeList[idx] = first->pNext;
+			_length[idx] = nBlock - 1;
+
+			// Slot runs out again, fetch more next time
+			auto maxBatch = _Pool::batchSize(idx);
+			auto batch = _batch[idx] ? 2 * _batch[idx] : _Pool::_MIN_BATCH;
+			_setBatch(idx, batch < maxBatch ? batch : maxBatch);
+			_overflows[idx] = 0;
+			return static_cast<void*>(first);
+		}
+
+		void _deallocSlow(void *p, size_t n)
+		{
+			auto pBlock = static_cast<_Block *>(p);
+			if (_state == _RETIRED) {
+				_Pool::releaseBatch(_Pool::index(n), pBlock, pBlock);
+				return;
+			}
+
+			_register();
+			dealloc(p, n);
+		}
+
+		// Slot {idx} grows too long
+		void _overflow(size_t idx)
+		{
+			if (_limit[idx] == 0) {
+				// First use of this slot
+				_setBatch(idx, _Pool::_MIN_BATCH);
+				if (_length[idx] <= _limit[idx]) {
+					return;
+				}
+			}
+
+			_giveBack(idx, _Pool::batchSize(idx));
+
+			// Blocks pile up, keep fewer of them
+			if (++_overflows[idx] > 1 && _batch[idx] > _Pool::_MIN_BATCH) {
+				_setBatch(idx, _batch[idx] / 2);
+			}
+		}
+
+		// Cut first {count} blocks [first, last] off 
+		// slot {idx}
+		_Block* _cut(size_t idx, size_t count, _Block *&last)
+		{
+			_Block *first = _freeList[idx];
+			last = first;
+			for (size_t i = 1; i < count; ++i) {
+				last = last->pNext;
+			}
+			_freeList[idx] = last->pNext;
+			_length[idx] -= count;
+			return first;
+		}
+
+		// Give back first {count} blocks of slot {idx}
+		// to central pool
+		void _release(size_t idx, size_t count)
+		{
+			_Block *last;
+			_Block *first = _cut(idx, count, last);
+			_Pool::releaseBatch(idx, first, last);
+		}
+
+		// Give back first {count} blocks of slot {idx}.
+		// Runs of blocks owned by another thread go to 
+		// its remote list, the rest go to central pool
+		// at once
+		void _giveBack(size_t idx, size_t count)
+		{
+			_Block *last;
+			_Block *pb = _cut(idx, count, last);
+			last->pNext = nullptr;
+
+			_Block *first = nullptr;
+			_Block *tail = nullptr;
+			std::uintptr_t page = 0;
+			size_t owner = 0;
+			while (pb) {
+				auto id = _ownerOf(pb, page, owner);
+				_Block *runLast = pb;
+				size_t run = 1;
+				while (runLast->pNext && _ownerOf(runLast->pNext, page, owner) == id) {
+					runLast = runLast->pNext;
+					++run;
+				}
+
+				auto next = runLast->pNext;
+				if (!_pushRemote(id, idx, pb, runLast, run)) {
+					runLast->pNext = nullptr;
+					if (tail) {
+						tail->pNext = pb;
+					}
+					else {
+						first = pb;
+					}
+					tail = runLast;
+				}
+				pb = next;
+			}
+
+			if (first) {
+				_Pool::releaseBatch(idx, first, tail);
+			}
+		}
+
+		// Push {count} blocks [first, last] of slot {idx} 
+		// to remote list of thread {id}.
+		// Return false if they aren't owned by another 
+		// living thread or the list is full
+		bool _pushRemote(size_t id, size_t idx, _Block *first, _Block *last, size_t count)
+		{
+			if (id == 0 || id == _id) {
+				return false;
+			}
+
+			auto &owner = _owners[id];
+			auto &remoteCnt = owner.remoteCnt[idx];
+			if (!owner.taken.load(std::memory_order_relaxed) ||
+				remoteCnt.load(std::memory_order_relaxed) + count > 
+				_REMOTE_BATCHES * _Pool::batchSize(idx)) {
+				return false;
+			}
+
+			remoteCnt.fetch_add(count, std::memory_order_relaxed);
+			auto &remote = owner.remote[idx];
+			_Block *head = remote.load(std::memory_order_relaxed);
+			do {
+				last->pNext = head;
+			} while (!remote.compare_exchange_weak(head, first, 
+				std::memory_order_release, std::memory_order_relaxed));
+			return true;
+		}
+
+		// Take all blocks [first, last] in remote list of
+		// slot {idx} of {owner}, {count} is set to their 
+		// number.
+		// Return null if the list is empty
+		static _Block* _takeRemote(_Owner &owner, size_t idx, size_t &count, _Block *&last)
+		{
+			auto &remote = owner.remote[idx];
+			if (!remote.load(std::memory_order_relaxed)) {
+				return nullptr;
+			}
+
+			_Block *first = remote.exchange(nullptr, std::memory_order_acquire);
+			if (!first) {
+				return nullptr;
+			}
+			count = 1;
+			last = first;
+			while (last->pNext) {
+				last = last->pNext;
+				++count;
+			}
+			owner.remoteCnt[idx].fetch_sub(count, std::memory_order_relaxed);
+			return first;
+		}
+
+		// Give all blocks in remote lists of {owner} 
+		// back to central pool
+		static void _drainOwner(_Owner &owner)
+		{
+			for (size_t idx = 0; idx < _Pool::_TABLE_SIZE; ++idx) {
+				size_t count;
+				_Block *last;
+				_Block *first = _takeRemote(owner, idx, count, last);
+				if (first) {
+					_Pool::releaseBatch(idx, first, last);
+				}
+			}
+		}
+
+		// Entry of page map for block {p}, leaf of the 
+		// entry is allocated if {create} is true.
+		// Return null if the entry isn't there
+		static _PageEntry* _pageEntry(const void *p, bool create)
+		{
+			auto page = reinterpret_cast<std::uintptr_t>(p) >> _PAGE_SHIFT;
+			auto root = page >> _LEAF_BITS;
+			if (root >= _ROOT_SIZE) {
+				return nullptr;
+			}
+
+			auto &slot = _pageOwner[root];
+			_PageEntry *leaf = slot.load(std::memory_order_acquire);
+			if (!leaf && create) {
+				// Zeroed pages of a large calloc() are 
+				// mapped on first touch
+				leaf = static_cast<_PageEntry*>(std::calloc(size_t(1) << _LEAF_BITS, sizeof(_PageEntry)));
+				_PageEntry *expected = nullptr;
+				if (leaf && !slot.compare_exchange_strong(expected, leaf, 
+					std::memory_order_acq_rel, std::memory_order_acquire)) {
+					// Another thread installed it first
+					std::free(leaf);
+					leaf = expected;
+				}
+			}
+			return leaf ? leaf + (page & ((size_t(1) << _LEAF_BITS) - 1)) : nullptr;
+		}
+
+		// Owner of block {p}, 0 if none.
+		// {page} and {owner} keep the last lookup, blocks
+		// in a row mostly lie in the same page
+		static size_t _ownerOf(const void *p, std::uintptr_t &page, size_t &owner)
+		{
+			auto pageOf = reinterpret_cast<std::uintptr_t>(p) >> _PAGE_SHIFT;
+			if (pageOf != page) {
+				auto entry = _pageEntry(p, false);
+				page = pageOf;
+				owner = entry ? entry->load(std::memory_order_relaxed) : 0;
+			}
+			return owner;
+		}
+
+		// Mark pages of the null-terminated list {first}
+		// as owned by this thread
+		void _own(_Block *first)
+		{
+			if (!_id) {
+				return;
+			}
+
+			std::uintptr_t page = 0;
+			for (auto pb = first; pb; pb = pb->pNext) {
+				auto pageOf = reinterpret_cast<std::uintptr_t>(pb) >> _PAGE_SHIFT;
+				if (pageOf == page) {
+					continue;
+				}
+				page = pageOf;
+
+				auto entry = _pageEntry(pb, true);
+				// Skip the store if the page is ours already,
+				// so the entry isn't written on every refill
+				if (entry && entry->load(std::memory_order_relaxed) != _id) {
+					entry->store(_id, std::memory_order_relaxed);
+				}
+			}
+		}
+
+		// Blocks freed to this thread later are kept in
+		// its remote lists until another thread takes 
+		// its entry or trim() drains them
+		void _retire()
+		{
+			flush();
+			if (_id) {
+				_drainOwner(_owners[_id]);
+				_owners[_id].taken.store(false, std::memory_order_release);
+				_id = 0;
+			}
+			_state = _RETIRED;
+		}
+	};
+
+	template<int hint>
+	thread_local _ThreadCache<hint> _ThreadCache<hint>::_local;
+
+	template<int hint>
+	typename _ThreadCache<hint>::_Owner _ThreadCache<hint>::_owners[_MAX_OWNERS];
+
+	template<int hint>
+	std::atomic<typename _ThreadCache<hint>::_PageEntry*> _ThreadCache<hint>::_pageOwner[_ROOT_SIZE];
+
+#ifdef USE_ALLOC_DEBUG
+	// ================= _DebugGuard =================
+
+	// Handle of misuse of pooled blocks, {what} happened 
+	// to block {p} of {n} bytes
+	using GuardHandle = void(*)(const char *what, const void *p, size_t n);
+
+	// Guard of pooled blocks, only used if USE_ALLOC_DEBUG
+	// is defined.
+	// A request of n bytes takes a larger block laid out as
+	//   | n | tag | n bytes of client | red zone |
+	// where red zone is the rest of the block, at least
+	// _RED_ZONE bytes. Freed blocks are filled with 
+	// _FREED_BYTE and checked when handed out again, so 
+	// writes after free are caught as well.
+	// Blocks with broken guard are never reused
+	template<int hint>
+	class _DebugGuard {
+		using _Pool = _CentralPool<hint>;
+
+		struct _Header
+		{
+			size_t size;	// Bytes asked by client
+			size_t tag;		// State of block xor its size class
+		};
+
+		static constexpr size_t _LIVE_TAG = static_cast<size_t>(0x4d5354444c495645ULL);
+		static constexpr size_t _FREED_TAG = static_cast<size_t>(0x4d53544446524545ULL);
+
+	public:
+		static constexpr size_t _HEADER_SIZE = sizeof(_Header);
+		static constexpr size_t _RED_ZONE = 16;
+
+		static constexpr unsigned char _NEW_BYTE = 0xcd;	// Fresh client bytes
+		static constexpr unsigned char _FREED_BYTE = 0xdd;	// Freed blocks
+		static constexpr unsigned char _RED_BYTE = 0xfd;	// Red zone
+
+		// Bytes taken from pool for a request of {n} bytes
+		static size_t guardedSize(size_t n) noexcept
+		{
+			return n + _HEADER_SIZE + _RED_ZONE;
+		}
+
+		// Lay guard on {block} taken for {n} bytes,
+		// return the part of client
+		static void* wrap(void *block, size_t n)
+		{
+			auto cls = _Pool::roundUp(guardedSize(n));
+			auto header = static_cast<_Header*>(block);
+			auto client = static_cast<unsigned char*>(block) + _HEADER_SIZE;
+			if (header->tag == (_FREED_TAG ^ cls) &&
+				!_filled(client, cls - _HEADER_SIZE, _FREED_BYTE)) {
+				_report("freed block is modified", client, n);
+			}
+
+			header->size = n;
+			header->tag = _LIVE_TAG ^ cls;
+			std::memset(client, _NEW_BYTE, n);
+			std::memset(client + n, _RED_BYTE, cls - _HEADER_SIZE - n);
+			_live[_Pool::index(cls)].fetch_add(1, std::memory_order_relaxed);
+			return client;
+		}
+
+		// Check guard of {p} given back for {n} bytes,
+		// return the block to give back to pool, or null
+		// if it is misused
+		static void* unwrap(void *p, size_t n)
+		{
+			auto cls = _Pool::roundUp(guardedSize(n));
+			auto client = static_cast<unsigned char*>(p);
+			auto header = static_cast<_Header*>(static_cast<void*>(client - _HEADER_SIZE));
+			if (header->tag == (_FREED_TAG ^ cls)) {
+				_report("block is freed twice", p, n);
+				return nullptr;
+			}
+			if (header->tag != (_LIVE_TAG ^ cls) || header->size != n) {
+				if (header->tag == (_LIVE_TAG ^ _Pool::roundUp(guardedSize(header->size)))) {
+					_report("block is freed with wrong size", p, n);
+				}
+				else {
+					_report("block isn't from pool or its header is overwritten", p, n);
+				}
+				return nullptr;
+			}
+
+			_live[_Pool::index(cls)].fetch_sub(1, std::memory_order_relaxed);
+			if (!_filled(client + n, cls - _HEADER_SIZE - n, _RED_BYTE)) {
+				_report("red zone is overwritten", p, n);
+				return nullptr;
+			}
+
+			std::memset(header, _FREED_BYTE, cls);
+			header->tag = _FREED_TAG ^ cls;
+			return header;
+		}
+
+		// Blocks of the size class of {n} bytes held by
+		// client
+		static size_t liveBlocks(size_t n) noexcept
+		{
+			return _live[_Pool::index(_Pool::roundUp(guardedSize(n)))].load(std::memory_order_relaxed);
+		}
+
+		// Print blocks held by client per size class to
+		// {out}, return the number of them
+		static size_t reportLeaks(FILE *out)
+		{
+			size_t total = 0;
+			for (size_t idx = 0; idx < _Pool::_TABLE_SIZE; ++idx) {
+				auto count = _live[idx].load(std::memory_order_relaxed);
+				if (count == 0) {
+					continue;
+				}
+				std::fprintf(out, "MSTD: %zu leaked block(s) of up to %zu bytes\n",
+							 count, _Pool::classSize(idx) - _HEADER_SIZE - _RED_ZONE);
+				total += count;
+			}
+			return total;
+		}
+
+		static GuardHandle setGuardHandle(GuardHandle pHandle)
+		{
+			return _guardHandle.exchange(pHandle);
+		}
+
+		// Report blocks still held by client at exit.
+		// It's a nifty counter like std::ios_base::Init,
+		// every translation unit including this header
+		// constructs one before its own statics, and the
+		// last one destroyed reports, so blocks of static
+		// containers are given back by then
+		struct _LeakReporter
+		{
+			_LeakReporter() noexcept
+			{
+				++_reporters;
+			}
+
+			~_LeakReporter()
+			{
+				if (--_reporters == 0) {
+					reportLeaks(stderr);
+				}
+			}
+		};
+
+	private:
+
+		static bool _filled(const unsigned char *p, size_t n, unsigned char byte) noexcept
+		{
+			for (size_t i = 0; i < n; ++i) {
+				if (p[i] != byte) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		// Call guard handle, or print and abort
+		// if there isn't any
+		static void _report(const char *what, const void *p, size_t n)
+		{
+			auto handle = _guardHandle.load();
+			if (handle) {
+				handle(what, p, n);
+				return;
+			}
+			std::fprintf(stderr, "MSTD: %s (block %p of %zu bytes)\n", what, p, n);
+			std::abort();
+		}
+
+		static std::atomic<size_t> _live[_Pool::_TABLE_SIZE];
+		static std::atomic<GuardHandle> _guardHandle;
+
+		// Leak reporters alive, only touched during
+		// static initialization and destruction
+		static size_t _reporters;
+	};
+
+	template<int hint>
+	std::atomic<size_t> _DebugGuard<hint>::_live[_Pool::_TABLE_SIZE] = {};
+
+	template<int hint>
+	std::atomic<GuardHandle> _DebugGuard<hint>::_guardHandle(nullptr);
+
+	template<int hint>
+	size_t _DebugGuard<hint>::_reporters = 0;
+
+	// Leak reporter of the default instance
+	static _DebugGuard<0>::_LeakReporter _leakReporter;
+#endif // USE_ALLOC_DEBUG
+
+	// ================= _DefaultMalloc =================
+
+	// Sub allocator
+	// Small requests are served by the cache of calling 
+	// thread which is backed by a shared central pool
+	template<int hint>
+	class _DefaultMalloc {
+		using _Pool = _CentralPool<hint>;
+		using _Cache = _ThreadCache<hint>;
+#ifdef USE_ALLOC_DEBUG
+		using _Guard = _DebugGuard<hint>;
+#endif // USE_ALLOC_DEBUG
+
+	public:
+		// Blocks are always aligned to it
+		static constexpr size_t _NATURAL_ALIGN = _Pool::_BLOCK_SIZE;
+
+		static void* alloc(size_t n)
+		{
+			auto size = _blockSize(n);
+			if (size > _Pool::_MAX_ALLOC || n == 0) {
+				_ALLOC_STAT(_StatCounter<hint>::fallbacks.fetch_add(1, std::memory_order_relaxed));
+				return _DirectMalloc<hint>::alloc(n);
+			}
+
+#ifdef USE_ALLOC_DEBUG
+			auto ret = _Guard::wrap(_Cache::alloc(size), n);
+#else
+			auto ret = _Cache::alloc(n);
+#endif // USE_ALLOC_DEBUG
+			// Counted once the block is got, refill of the
+			// cache may throw
+			_ALLOC_STAT(_StatCounter<hint>::inUse.fetch_add(_Pool::roundUp(size), std::memory_order_relaxed));
+			return ret;
+		}
+
+		static void dealloc(void *p, size_t n)
+		{
+			auto size = _blockSize(n);
+			if (size > _Pool::_MAX_ALLOC || n == 0) {
+				_DirectMalloc<hint>::dealloc(p, n);
+				return;
+			}
+
+			if (p) {
+#ifdef USE_ALLOC_DEBUG
+				p = _Guard::unwrap(p, n);
+				if (!p) {
+					return;
+				}
+#endif // USE_ALLOC_DEBUG
+				_ALLOC_STAT(_StatCounter<hint>::inUse.fetch_sub(_Pool::roundUp(size), std::memory_order_relaxed));
+				_Cache::dealloc(p, size);
+			}
+		}
+
+		// Bytes usable in a block of {n} bytes, which is 
+		// the size class it falls in
+		static size_t goodSize(size_t n) noexcept
+		{
+			auto size = _blockSize(n);
+			if (size > _Pool::_MAX_ALLOC || n == 0) {
+				return _DirectMalloc<hint>::goodSize(n);
+			}
+#ifdef USE_ALLOC_DEBUG
+			// Guard sits right after {n} bytes
+			return n;
+#else
+			return _Pool::roundUp(n);
+#endif // USE_ALLOC_DEBUG
+		}
+
+		// Resize block {p} of {n} bytes to {newSize} bytes 
+		// without moving it, so that it is deallocated with
+		// {newSize} later. Both sizes must fall in the same
+		// size class of pool, or both be served by system
+		static bool tryExpandInPlace(void *p, size_t n, size_t newSize) noexcept
+		{
+			auto size = _blockSize(n);
+			auto newBlock = _blockSize(newSize);
+			if (size > _Pool::_MAX_ALLOC || newBlock > _Pool::_MAX_ALLOC) {
+				return size > _Pool::_MAX_ALLOC && newBlock > _Pool::_MAX_ALLOC &&
+					_DirectMalloc<hint>::tryExpandInPlace(p, n, newSize);
+			}
+			if (n == 0 || newSize == 0) {
+				return n == newSize;
+			}
+#ifdef USE_ALLOC_DEBUG
+			// Guard of {p} sits right after {n} bytes
+			return n == newSize;
+#else
+			return _Pool::roundUp(newBlock) == _Pool::roundUp(size);
+#endif // USE_ALLOC_DEBUG
+		}
+
+		// Resize block {p} of {n} bytes to {newSize} bytes,
+		// its bytes are kept and it may be moved. Blocks 
+		// too large for pool are resized by system, others
+		// are copied unless they fit in place
+		static void* reallocate(void *p, size_t n, size_t newSize)
+		{
+			if (_blockSize(n) > _Pool::_MAX_ALLOC && _blockSize(newSize) > _Pool::_MAX_ALLOC) {
+				return _DirectMalloc<hint>::reallocate(p, n, newSize);
+			}
+			if (p && n != 0 && tryExpandInPlace(p, n, newSize)) {
+				return p;
+			}
+
+			auto ret = alloc(newSize);
+			if (p) {
+				std::memcpy(ret, p, n < newSize ? n : newSize);
+			}
+			dealloc(p, n);
+			return ret;
+		}
+
+		// Allocate {n} bytes aligned to {align}, a power
+		// of 2 no larger than _MAX_ALIGN.
+		// Over-aligned block is cut from a larger one 
+		// taken from pool, or from system if too large
+		static void* allocAligned(size_t n, size_t align)
+		{
+			if (align <= _NATURAL_ALIGN) {
+				return alloc(n);
+			}
+			return _alignBlock(alloc(_alignedRequest(n, align)), align);
+		}
+
+		// Deallocate {p} from allocAligned
+		static void deallocAligned(void *p, size_t n, size_t align)
+		{
+			if (align <= _NATURAL_ALIGN) {
+				dealloc(p, n);
+			}
+			else if (p) {
+				dealloc(_baseOfAligned(p), _alignedRequest(n, align));
+			}
+		}
+
+		// Allocate {count} blocks of {n} bytes linked
+		// through their first word, null terminated
+		static void* allocBatch(size_t n, size_t count)
+		{
+			if (count == 0) {
+				return nullptr;
+			}
+			if (n > _Pool::_MAX_ALLOC || n == 0) {
+				_ALLOC_STAT(_StatCounter<hint>::fallbacks.fetch_add(count, std::memory_order_relaxed));
+				return _DirectMalloc<hint>::allocBatch(n, count);
+			}
+#ifdef USE_ALLOC_DEBUG
+			// Blocks are guarded one by one
+			void *first = nullptr;
+			size_t got = 0;
+			_MSTD_TRY
+				for (; got < count; ++got) {
+					auto p = alloc(n);
+					*static_cast<void**>(p) = first;
+					first = p;
+				}
+			_MSTD_CATCH_ALL
+				deallocBatch(first, n, got);
+				throw;
+			_MSTD_END_CATCH
+			return first;
+#else
+			auto ret = _Cache::allocBatch(n, count);
+			_ALLOC_STAT(_StatCounter<hint>::inUse.fetch_add(_Pool::roundUp(n) * count, std::memory_order_relaxed));
+			return static_cast<void*>(ret);
+#endif // USE_ALLOC_DEBUG
+		}
+
+		// Deallocate {count} blocks of {n} bytes linked
+		// like a batch
+		static void deallocBatch(void *first, size_t n, size_t count)
+		{
+			if (count == 0) {
+				return;
+			}
+			if (n > _Pool::_MAX_ALLOC || n == 0) {
+				_DirectMalloc<hint>::deallocBatch(first, n, count);
+				return;
+			}
+#ifdef USE_ALLOC_DEBUG
+			for (; count > 0; --count) {
+				auto next = *static_cast<void**>(first);
+				dealloc(first, n);
+				first = next;
+			}
+#else
+			_ALLOC_STAT(_StatCounter<hint>::inUse.fetch_sub(_Pool::roundUp(n) * count, std::memory_order_relaxed));
+			_Cache::deallocBatch(static_cast<_Block*>(first), n, count);
+#endif // USE_ALLOC_DEBUG
+		}
+
+		// Flush cache of calling thread and remote lists,
+		// then give idle heap space back to system.
+		// Return the number of bytes released
+		static size_t trim()
+		{
+			_Cache::flush();
+			_Cache::drainRemote();
+			return _Pool::trim();
+		}
+
+		// Release idle heap space automatically once
+		// it exceeds {bytes}
+		static void setTrimThreshold(size_t bytes)
+		{
+			_Pool::setTrimThreshold(bytes);
+		}
+
+		// Change where memory pool fetches new chunks,
+		// e.g. hugePageChunkProvider().
+		// Return the previous provider
+		static const ChunkProvider& setChunkProvider(const ChunkProvider &provider)
+		{
+			return _Pool::setChunkProvider(provider);
+		}
+
+#ifdef USE_ALLOC_STATS
+		static AllocStats stats()
+		{
+			AllocStats st = {};
+			st.inUse = _StatCounter<hint>::inUse.load(std::memory_order_relaxed);
+			st.refills = _StatCounter<hint>::refills.load(std::memory_order_relaxed);
+			st.chunkFetches = _StatCounter<hint>::chunkFetches.load(std::memory_order_relaxed);
+			st.fallbacks = _StatCounter<hint>::fallbacks.load(std::memory_order_relaxed);
+			st.omHandles = _StatCounter<hint>::omHandles.load(std::memory_order_relaxed);
+			st.remote = _Cache::remoteBytes();
+			_Pool::collect(st);
+			return st;
+		}
+
+		// Print statistics of memory pool to {os}
+		static void dumpStats(std::ostream &os)
+		{
+			stats().dump(os);
+		}
+#endif // USE_ALLOC_STATS
+
+#ifdef USE_ALLOC_DEBUG
+		// Pooled blocks of the size class of {n} bytes
+		// held by client
+		static size_t liveBlocks(size_t n) noexcept
+		{
+			return _Guard::liveBlocks(n);
+		}
+
+		// Print pooled blocks held by client per size
+		// class, which is done at exit as well.
+		// Return the number of them
+		static size_t reportLeaks(FILE *out = stderr)
+		{
+			return _Guard::reportLeaks(out);
+		}
+
+		// Handle misuse of pooled blocks by {pHandle} instead
+		// of aborting, null to abort again.
+		// Return the previous handle
+		static GuardHandle setGuardHandle(GuardHandle pHandle)
+		{
+			return _Guard::setGuardHandle(pHandle);
+		}
+#endif // USE_ALLOC_DEBUG
+
+	private:
+		// Bytes taken from pool for a request of {n} bytes
+		static size_t _blockSize(size_t n) noexcept
+		{
+#ifdef USE_ALLOC_DEBUG
+			return _Guard::guardedSize(n);
+#else
+			return n;
+#endif // USE_ALLOC_DEBUG
+		}
+	};
+
 	using defaultAlloc = _DefaultMalloc<0>;
 }
\ No newline at end of file
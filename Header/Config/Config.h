@@ -33,6 +33,10 @@
 	#define _MSTD_END_CATCH		}
 #endif
 
+/* #undef USE_ALLOC_STATS */
+
+/* #undef USE_ALLOC_DEBUG */
+
 // STL version setting
 #define CPP_STD 11
 
@@ -11,13 +11,22 @@
 // STL header and cpp standard header
 #include <initializer_list>
 #include <stdexcept>
+#include <cstring>
 
 namespace MSTD {
 
-// Default buffer size (elements per buffer)
-#define DEQUE_BUFFER_SIZE (sizeof(ValueType) >= 512 ? 1 : 512 / sizeof(ValueType))
 // Default map list size
 #define DEQUE_MAP_SIZE 8
+// Spare buffers kept for reuse instead of being freed
+#define DEQUE_SPARE_BLOCKS 2
+
+	// Default buffer size (elements per buffer) of Deque<T>.
+	// Buffers of small elements take 512 bytes, large elements
+	// still get 16 in a buffer, so that a buffer isn't
+	// allocated for every few elements
+	template<typename T>
+	struct _DequeBlockSize : integralConstant<size_t,
+							sizeof(T) <= 32 ? 512 / sizeof(T) : 16> {};
 
 	template<typename _Deque>
 	class _DequeConstIterator
@@ -42,14 +51,14 @@ namespace MSTD {
 
 		_DequeConstIterator(_MapPtr node) :
 			_first(*node),
-			_last(*node + DEQUE_BUFFER_SIZE),
+			_last(*node + _Deque::_BLOCK_SIZE),
 			_cur(_first),
 			_node(node)
 		{}
 
 		_DequeConstIterator(_BufferPtr pos, _MapPtr node) :
 			_first(*node),
-			_last(*node + DEQUE_BUFFER_SIZE),
+			_last(*node + _Deque::_BLOCK_SIZE),
 			_cur(pos),
 			_node(node)
 		{}
@@ -57,7 +66,7 @@ namespace MSTD {
 		void _setNode(_MapPtr node)
 		{
 			_first = *node;
-			_last = *node + DEQUE_BUFFER_SIZE;
+			_last = *node + _Deque::_BLOCK_SIZE;
 			_cur = _first;
 			_node = node;
 		}
@@ -112,10 +121,10 @@ namespace MSTD {
 			DifferenceType offset = diff + (_cur - _first);
 
 			DifferenceType buffSkip = offset >= 0 ?
-				offset / DEQUE_BUFFER_SIZE
-				: -((offset + 1) / static_cast<DifferenceType>(DEQUE_BUFFER_SIZE) + 1);
+				offset / _Deque::_BLOCK_SIZE
+				: -((-offset - 1) / static_cast<DifferenceType>(_Deque::_BLOCK_SIZE) + 1);
 			_setNode(_node + buffSkip);
-			_cur = _first + (offset - buffSkip * DEQUE_BUFFER_SIZE);
+			_cur = _first + (offset - buffSkip * static_cast<DifferenceType>(_Deque::_BLOCK_SIZE));
 
 			return *this;
 		}
@@ -143,7 +152,7 @@ namespace MSTD {
 
 		DifferenceType operator-(const _DequeConstIterator &that) const
 		{
-			return (_node - that._node - 1) * DEQUE_BUFFER_SIZE +
+			return (_node - that._node - 1) * _Deque::_BLOCK_SIZE +
 				(_cur - _first) + (that._last - that._cur);
 		}
 
@@ -265,10 +274,10 @@ namespace MSTD {
 			DifferenceType offset = diff + (_cur - _first);
 
 			DifferenceType buffSkip = offset >= 0 ?
-				offset / DEQUE_BUFFER_SIZE 
-				: -((offset + 1) / static_cast<DifferenceType>(DEQUE_BUFFER_SIZE) + 1);
+				offset / _Deque::_BLOCK_SIZE 
+				: -((-offset - 1) / static_cast<DifferenceType>(_Deque::_BLOCK_SIZE) + 1);
 			_setNode(_node + buffSkip);
-			_cur = _first + (offset - buffSkip * DEQUE_BUFFER_SIZE);
+			_cur = _first + (offset - buffSkip * static_cast<DifferenceType>(_Deque::_BLOCK_SIZE));
 
 			return *this;
 		}
@@ -291,7 +300,7 @@ namespace MSTD {
 
 		DifferenceType operator-(const _DequeIterator &that) const
 		{
-			return (_node - that._node - 1) * DEQUE_BUFFER_SIZE +
+			return (_node - that._node - 1) * _Deque::_BLOCK_SIZE +
 				(_cur - _first) + (that._last - that._cur);
 		}
 
@@ -301,11 +310,65 @@ namespace MSTD {
 		}
 	};
 
+	// Iterators of Deque are segmented by buffers
+	template<typename _Deque, typename _Iter, typename _Local>
+	struct _DequeSegmentTraits
+	{
+		static constexpr bool isSegmented = true;
+
+		using SegmentIterator = typename _Deque::_MapPtr;
+		using LocalIterator = _Local;
+
+		static SegmentIterator segment(const _Iter &it)
+		{
+			return it._node;
+		}
+
+		static LocalIterator local(const _Iter &it)
+		{
+			return it._cur;
+		}
+
+		static LocalIterator begin(SegmentIterator node)
+		{
+			return *node;
+		}
+
+		static LocalIterator end(SegmentIterator node)
+		{
+			return *node + _Deque::_BLOCK_SIZE;
+		}
+
+		// End of a buffer is the start of the next one, which is
+		// allocated as long as {pos} is within the deque
+		static _Iter compose(SegmentIterator node, LocalIterator pos)
+		{
+			if (pos == end(node)) {
+				return _Iter(node + 1);
+			}
+			return _Iter(const_cast<typename _Deque::_BufferPtr>(pos), node);
+		}
+	};
+
+	template<typename _Deque>
+	struct SegmentedIteratorTraits<_DequeConstIterator<_Deque>>
+		: _DequeSegmentTraits<_Deque, _DequeConstIterator<_Deque>, typename _Deque::ConstPointer> {};
+
+	template<typename _Deque>
+	struct SegmentedIteratorTraits<_DequeIterator<_Deque>>
+		: _DequeSegmentTraits<_Deque, _DequeIterator<_Deque>, typename _Deque::Pointer> {};
+
+	// Deque<T>
+	// Elements are kept in buffers of {BlockSize} elements,
+	// see _DequeBlockSize for the default
 	template<
 		typename T,
-		typename Alloc = MSTD::Allocator<T>
+		typename Alloc = MSTD::Allocator<T>,
+		size_t BlockSize = _DequeBlockSize<T>::value
 	> class Deque
 	{
+		static_assert(BlockSize > 0, "Buffer of Deque can't be empty");
+
 	public:
 		using AllocatorType = Alloc;
 		using DifferenceType = ptrdiff_t;
@@ -322,8 +385,10 @@ namespace MSTD {
 
 		using _BufferPtr = Pointer;
 		using _MapPtr = _BufferPtr * ;
-		using _BufferAlloc = MSTD::Allocator<ValueType>;
-		using _MapAlloc = MSTD::Allocator<_BufferPtr>;
+		using _BufferAlloc = typename AllocatorTraits<Alloc>::template rebind<ValueType>;
+		using _MapAlloc = typename AllocatorTraits<Alloc>::template rebind<_BufferPtr>;
+
+		static constexpr SizeType _BLOCK_SIZE = BlockSize;
 
 		static_assert(isSame<ValueType, typename AllocatorTraits<Alloc>::ValueType>::value,
 			"Allocator require the same type T with Deque<T>");
@@ -335,23 +400,20 @@ namespace MSTD {
 		/////////////////////////////////////
 
 		Deque() :
-			_map(nullptr),			
-			_beg(),
-			_end(),
-			_alloc(),
-			_bufferAlloc(),
-			_mapAlloc()
-		{
-			_initialize();
-		}
+			Deque(Alloc())
+		{}
 
-		Deque(const Alloc &alloc) :
+		explicit Deque(const Alloc &alloc) :
 			_map(nullptr),
+			_mapSize(0),
 			_beg(),
 			_end(),
+			_spareCount(0),
+			_reservedFront(0),
+			_reservedBack(0),
 			_alloc(alloc),
-			_bufferAlloc(),
-			_mapAlloc()
+			_bufferAlloc(alloc),
+			_mapAlloc(alloc)
 		{
 			_initialize();
 		}
@@ -359,9 +421,7 @@ namespace MSTD {
 		Deque(SizeType count, const ValueType &val, const Alloc &alloc = Alloc()) :
 			Deque(alloc)
 		{
-			while (count--) {
-				_auxInsert(_end, val);
-			}
+			_appendFill(count, val);
 		}
 
 		explicit Deque(SizeType count) :
@@ -375,36 +435,57 @@ namespace MSTD {
 				void
 			>::type
 		>
-		Deque(InputIt first, InputIt last, const Alloc &alloc) :
+		Deque(InputIt first, InputIt last, const Alloc &alloc = Alloc()) :
 			Deque(alloc)
 		{
-			for (; first != last; ++first) {
-				_auxInsert(_end, *first);
-			}
+			_appendRange(first, last, typename IteratorTraits<InputIt>::IteratorCategory());
 		}
 
-		Deque(const Deque &other, const Alloc &alloc = Alloc()) :
+		Deque(const Deque &other) :
+			Deque(other.begin(), other.end(), other._alloc)
+		{}
+
+		Deque(const Deque &other, const Alloc &alloc) :
 			Deque(other.begin(), other.end(), alloc)
 		{}
 
-		Deque(Deque &&that, const Alloc &alloc) noexcept:
-			_map(move(that._map)),
-			_mapSize(move(that._mapSize)),
-			_beg(move(that._beg)),
-			_end(move(that.end)),
+		// Steal the buffers of {that} only if they are
+		// released by {alloc}, otherwise move elements
+		Deque(Deque &&that, const Alloc &alloc) :
+			_map(nullptr),
+			_mapSize(0),
+			_beg(),
+			_end(),
+			_spareCount(0),
+			_reservedFront(0),
+			_reservedBack(0),
 			_alloc(alloc),
-			_bufferAlloc(),
-			_mapAlloc()
+			_bufferAlloc(alloc),
+			_mapAlloc(alloc)
 		{
-			that._map = nullptr;
-			that._mapSize = 0;
-			that._beg._first = that._beg._last = that._beg._cur = nullptr;
-			that._end._first = that._end._last = that._end._cur = nullptr;
+			if (_alloc == that._alloc) {
+				_swapStorage(that);
+			}
+			else {
+				_initialize();
+				_moveFrom(that);
+			}
 		}
 
 		Deque(Deque &&that) noexcept :
-			Deque(move(that), that._alloc)
-		{}
+			_map(nullptr),
+			_mapSize(0),
+			_beg(),
+			_end(),
+			_spareCount(0),
+			_reservedFront(0),
+			_reservedBack(0),
+			_alloc(that._alloc),
+			_bufferAlloc(that._bufferAlloc),
+			_mapAlloc(that._mapAlloc)
+		{
+			_swapStorage(that);
+		}
 
 		Deque(std::initializer_list<ValueType> il, const Alloc &alloc = Alloc()) :
 			Deque(il.begin(), il.end(), alloc)
@@ -417,30 +498,27 @@ namespace MSTD {
 
 		Deque& operator=(const Deque& that)
 		{
-			if (this != addressof(that)) {
+			if (this != MSTD::addressof(that)) {
 				_destroy();
-				_alloc = that._alloc;
 				_initialize();
-				for (auto it = that.begin(); it != that.end(); ++it) {
-					_auxInsert(_end, *it);
-				}
+				_appendRange(that.begin(), that.end(), RandomAccessIteratorTag());
 			}
 			return *this;
 		}
 
-		Deque& operator=(Deque &&that) noexcept
+		// Allocator is kept, buffers of {that} are stolen
+		// only if both allocators are equal
+		Deque& operator=(Deque &&that)
 		{
-			if (this != addressof(that)) {
+			if (this != MSTD::addressof(that)) {
 				_destroy();
-				_alloc = that._alloc;
-				_map = move(that._map);
-				_mapSize = that._mapSize;
-				_beg = move(that._beg);
-				_end = move(that._end);
-				that._map = nullptr;
-				that._mapSize = 0;
-				that._beg._first = that._beg._last = that._beg._cur = nullptr;
-				that._end._first = that._end._last = that._end._cur = nullptr;
+				if (_alloc == that._alloc) {
+					_swapStorage(that);
+				}
+				else {
+					_initialize();
+					_moveFrom(that);
+				}
 			}
 			return *this;
 		}
@@ -449,13 +527,11 @@ namespace MSTD {
 		{
 			_destroy();			
 			_initialize();
-			for (auto &&val : il) {
-				_auxInsert(_end, val);
-			}
+			_appendRange(il.begin(), il.end(), RandomAccessIteratorTag());
 			return *this;
 		}
 
-		Alloc getAllocator() noexcept
+		Alloc getAllocator() const noexcept
 		{
 			return _alloc;
 		}
@@ -595,6 +671,82 @@ namespace MSTD {
 			return _alloc.maxSize();
 		}
 
+		// Make room for {count} more elements at the back, so
+		// pushing them neither allocates buffers nor moves map.
+		// Popping at the back keeps that room until shrinkToFit()
+		void reserveBack(SizeType count)
+		{
+			if (count > _reservedBack) {
+				_reservedBack = count;
+			}
+			// Nodes after {_end} reached by pushing {count}
+			SizeType nodes = (static_cast<SizeType>(_end._cur - _end._first) + count) / _BLOCK_SIZE;
+			SizeType room = _map + _mapSize - 1 - _end._node;
+			if (nodes > room) {
+				_reallocateMap(nodes, false);
+			}
+			for (SizeType i = 1; i <= nodes; ++i) {
+				auto node = _end._node + i;
+				if (!*node) {
+					*node = _allocateBuffer();
+				}
+			}
+		}
+
+		// Make room for {count} more elements at the front
+		void reserveFront(SizeType count)
+		{
+			if (count > _reservedFront) {
+				_reservedFront = count;
+			}
+			// Nodes before {_beg} reached by pushing {count}
+			SizeType before = _beg._cur - _beg._first;
+			SizeType nodes = count > before ? (count - before + _BLOCK_SIZE - 1) / _BLOCK_SIZE : 0;
+			SizeType room = _beg._node - _map;
+			if (nodes > room) {
+				_reallocateMap(nodes, true);
+			}
+			for (SizeType i = 1; i <= nodes; ++i) {
+				auto node = _beg._node - i;
+				if (!*node) {
+					*node = _allocateBuffer();
+				}
+			}
+		}
+
+		// Free buffers out of use, spare ones included, and
+		// shrink map to the nodes in use
+		void shrinkToFit()
+		{
+			if (!_map) {
+				// Moved from
+				return;
+			}
+			SizeType nodeNum = _end._node - _beg._node + 1;
+			_MapPtr newMap = nodeNum < _mapSize ? _getMap(nodeNum) : nullptr;
+
+			for (auto node = _map; node != _map + _mapSize; ++node) {
+				if ((node < _beg._node || node > _end._node) && *node) {
+					_bufferAlloc.deallocate(*node, _BLOCK_SIZE);
+					*node = nullptr;
+				}
+			}
+			while (_spareCount > 0) {
+				_bufferAlloc.deallocate(_spare[--_spareCount], _BLOCK_SIZE);
+			}
+			_reservedFront = 0;
+			_reservedBack = 0;
+
+			if (newMap) {
+				std::memcpy(newMap, _beg._node, nodeNum * sizeof(_MapPtr));
+				_mapAlloc.deallocate(_map, _mapSize);
+				_map = newMap;
+				_mapSize = nodeNum;
+				_beg._node = newMap;
+				_end._node = newMap + nodeNum - 1;
+			}
+		}
+
 		/////////////////////////////////////
 		//
 		//			Modifiers
@@ -605,26 +757,28 @@ namespace MSTD {
 		{
 			_destroy();
 			_initialize();
+			_reservedFront = 0;
+			_reservedBack = 0;
 		}
 
 		void pushBack(const ValueType &val)
 		{
-			_auxInsert(end(), val);
+			_emplaceAtBack(val);
 		}
 
 		void pushBack(ValueType &&val)
 		{
-			_auxInsert(end(), MSTD::move(val));
+			_emplaceAtBack(MSTD::move(val));
 		}
 
 		void pushFront(const ValueType &val)
 		{
-			_auxInsert(begin(), val);
+			_emplaceAtFront(val);
 		}
 
 		void pushFront(ValueType &&val)
 		{
-			_auxInsert(begin(), MSTD::move(val));
+			_emplaceAtFront(MSTD::move(val));
 		}
 
 		void popBack()
@@ -653,19 +807,19 @@ namespace MSTD {
 		template<typename... Args>
 		Iterator emplace(ConstIterator pos, Args&&... args)
 		{
-			return _auxEmplace(pos, forward<Args>(args)...);
+			return _auxEmplace(pos, MSTD::forward<Args>(args)...);
 		}
 
 		template<typename... Args>
 		void emplaceBack(Args&&... args)
 		{
-			_auxEmplace(_end, forward<Args>(args)...);
+			_emplaceAtBack(MSTD::forward<Args>(args)...);
 		}
 
 		template<typename... Args>
 		void emplaceFront(Args&&... args)
 		{
-			_auxEmplace(_beg, forward<Args>(args)...);
+			_emplaceAtFront(MSTD::forward<Args>(args)...);
 		}
 
 		Iterator insert(ConstIterator pos, const ValueType &val)
@@ -675,7 +829,7 @@ namespace MSTD {
 
 		Iterator insert(ConstIterator pos, ValueType &&val)
 		{
-			return _auxInsert(pos, move(val));
+			return _auxInsert(pos, MSTD::move(val));
 		}
 
 		Iterator insert(ConstIterator pos, SizeType count, const ValueType &val)
@@ -715,7 +869,12 @@ namespace MSTD {
 			swap(_mapSize, that._mapSize);
 			swap(_beg, that._beg);
 			swap(_end, that._end);
+			_swapSpare(that);
+			swap(_reservedFront, that._reservedFront);
+			swap(_reservedBack, that._reservedBack);
 			swap(_alloc, that._alloc);
+			swap(_bufferAlloc, that._bufferAlloc);
+			swap(_mapAlloc, that._mapAlloc);
 		}
 		
 		
@@ -725,6 +884,10 @@ namespace MSTD {
 		SizeType _mapSize; // Size of current map array
 		Iterator _beg; // Pointer to first buffer
 		Iterator _end; // Pointer to last buffer
+		_BufferPtr _spare[DEQUE_SPARE_BLOCKS]; // Emptied buffers kept for reuse
+		SizeType _spareCount; // Number of spare buffers
+		SizeType _reservedFront; // Room kept at the front by reserveFront()
+		SizeType _reservedBack; // Room kept at the back by reserveBack()
 		// Allocators
 		Alloc _alloc;
 		_BufferAlloc _bufferAlloc;
@@ -734,16 +897,24 @@ namespace MSTD {
 
 		void _destroy()
 		{
+			if (!_map) {
+				// Moved from
+				return;
+			}
 			_cleanUp();
 			for (SizeType i = 0; i < _mapSize; ++i) {
 				if (*(_map + i)) {
-					_bufferAlloc.deallocate(*(_map + i), DEQUE_BUFFER_SIZE);
+					_bufferAlloc.deallocate(*(_map + i), _BLOCK_SIZE);
 					*(_map + i) = nullptr;
 				}
 			}
 			_mapAlloc.deallocate(_map, _mapSize);
 			_map = nullptr;
 			_mapSize = 0;
+
+			while (_spareCount > 0) {
+				_bufferAlloc.deallocate(_spare[--_spareCount], _BLOCK_SIZE);
+			}
 		}
 
 		void _auxCleanUp(trueType)
@@ -776,6 +947,107 @@ namespace MSTD {
 			}
 		}
 
+		// Exchange map and buffers with {that}, allocators
+		// are left unchanged
+		void _swapStorage(Deque &that) noexcept
+		{
+			using std::swap;
+			swap(_map, that._map);
+			swap(_mapSize, that._mapSize);
+			swap(_beg, that._beg);
+			swap(_end, that._end);
+			_swapSpare(that);
+			swap(_reservedFront, that._reservedFront);
+			swap(_reservedBack, that._reservedBack);
+		}
+
+		void _swapSpare(Deque &that) noexcept
+		{
+			using std::swap;
+			for (SizeType i = 0; i < DEQUE_SPARE_BLOCKS; ++i) {
+				swap(_spare[i], that._spare[i]);
+			}
+			swap(_spareCount, that._spareCount);
+		}
+
+		// Buffer for a new node, a spare one if any, so that
+		// a queue pushed at one end and popped at the other
+		// doesn't allocate once it's warmed up
+		_BufferPtr _allocateBuffer()
+		{
+			if (_spareCount > 0) {
+				return _spare[--_spareCount];
+			}
+			return _bufferAlloc.allocate(_BLOCK_SIZE);
+		}
+
+		// Keep emptied buffer {buffer} as a spare one if
+		// there's room, otherwise free it
+		void _releaseBuffer(_BufferPtr buffer)
+		{
+			if (_spareCount < DEQUE_SPARE_BLOCKS) {
+				_spare[_spareCount++] = buffer;
+			}
+			else {
+				_bufferAlloc.deallocate(buffer, _BLOCK_SIZE);
+			}
+		}
+
+		// Move elements of {that} to the back of {this}
+		void _moveFrom(Deque &that)
+		{
+			for (auto it = that.begin(); it != that.end(); ++it) {
+				_emplaceAtBack(MSTD::move(*it));
+			}
+		}
+
+		// Elements which fit in buffer of {_end}, at most {count}.
+		// Filling it up moves {_end} to the next buffer
+		SizeType _roomAtEnd(SizeType count) const noexcept
+		{
+			SizeType room = _end._last - _end._cur;
+			return count < room ? count : room;
+		}
+
+		// Construct {count} copies of {val} at the back, a buffer
+		// at a time
+		void _appendFill(SizeType count, const ValueType &val)
+		{
+			reserveBack(count);
+			while (count > 0) {
+				auto chunk = _roomAtEnd(count);
+				uninitializedFill_N(_end._cur, chunk, val);
+				_end += chunk;
+				count -= chunk;
+			}
+		}
+
+		template<typename InputIt>
+		void _appendRange(InputIt first, InputIt last, InputIteratorTag)
+		{
+			for (; first != last; ++first) {
+				_emplaceAtBack(*first);
+			}
+		}
+
+		// Length of the range is known, so room is reserved at
+		// once and elements are copied a buffer at a time
+		template<typename ForwardIt>
+		void _appendRange(ForwardIt first, ForwardIt last, ForwardIteratorTag)
+		{
+			auto count = static_cast<SizeType>(MSTD::distance(first, last));
+			reserveBack(count);
+			while (count > 0) {
+				auto chunk = _roomAtEnd(count);
+				auto mid = first;
+				MSTD::advance(mid, chunk);
+				uninitializedCopy(first, mid, _end._cur);
+				_end += chunk;
+				first = mid;
+				count -= chunk;
+			}
+		}
+
 		_MapPtr _getMap(SizeType n)
 		{
 			auto map = _mapAlloc.allocate(n);
@@ -789,7 +1061,7 @@ namespace MSTD {
 		{			
 			_mapSize = DEQUE_MAP_SIZE;
 			_map = _getMap(DEQUE_MAP_SIZE);
-			_map[DEQUE_MAP_SIZE / 2] = _bufferAlloc.allocate(DEQUE_BUFFER_SIZE);
+			_map[DEQUE_MAP_SIZE / 2] = _allocateBuffer();
 			// Set {_beg} points to the middle of map
 			// and hence Deque can grow up towards two directions
 			_beg._setNode(_map + DEQUE_MAP_SIZE / 2);
@@ -799,15 +1071,42 @@ namespace MSTD {
 		// Add another {addCnt} nodes
 		void _reallocateMap(SizeType addCnt, bool addAtFront)
 		{
-			SizeType oldNodeNum = _end._node - _beg._node + 1;
+			// Buffers reserved right before {_beg} and after
+			// {_end} are moved with those in use
+			auto first = _beg._node;
+			auto last = _end._node + 1;
+			while (first != _map && *(first - 1)) {
+				--first;
+			}
+			while (last != _map + _mapSize && *last) {
+				++last;
+			}
+			SizeType oldNodeNum = last - first;
 			SizeType newCnt = oldNodeNum + addCnt;
+			auto begOffset = _beg._node - first;
+			auto endOffset = _end._node - first;
 			_MapPtr nStart;
 
+			// Release buffers out of [first, last) since
+			// only those nodes are moved
+			for (auto node = _map; node != _map + _mapSize; ++node) {
+				if ((node < first || node >= last) && *node) {
+					_releaseBuffer(*node);
+					*node = nullptr;
+				}
+			}
+
 			if (_mapSize > 2 * newCnt) {
 				// Enough space, just move content
 				nStart = _map + (_mapSize - newCnt) / 2
 					+ (addAtFront ? addCnt : 0);
-				std::memmove(nStart, _beg._node, oldNodeNum * sizeof(_MapPtr));
+				std::memmove(nStart, first, oldNodeNum * sizeof(_MapPtr));
+				// Clear stale pointers left by moving
+				for (auto node = _map; node != _map + _mapSize; ++node) {
+					if (node < nStart || node >= nStart + oldNodeNum) {
+						*node = nullptr;
+					}
+				}
 			}
 			else {
 				// Reallocate map
@@ -816,7 +1115,7 @@ namespace MSTD {
 				nStart = newMapPtr + (newMapSize - newCnt) / 2
 					+ (addAtFront ? addCnt : 0);
 				// Copy nodes pointers from old map
-				std::memmove(nStart, _beg._node, oldNodeNum * sizeof(_MapPtr));
+				std::memmove(nStart, first, oldNodeNum * sizeof(_MapPtr));
 				// Deallocate old map
 				_mapAlloc.deallocate(_map, _mapSize);
 				// Set new map
@@ -825,8 +1124,8 @@ namespace MSTD {
 			}
 
 			// Set new start mode
-			_beg._node = nStart;
-			_end._node = nStart + oldNodeNum - 1;
+			_beg._node = nStart + begOffset;
+			_end._node = nStart + endOffset;
 		}
 
 		// Copy range [first, last) forward starting at {dest}
@@ -867,7 +1166,7 @@ namespace MSTD {
 					auto preBuffer = _beg._node - 1;
 					if (!*preBuffer) {
 						// Allocate new buffer
-						*preBuffer = _bufferAlloc.allocate(DEQUE_BUFFER_SIZE);
+						*preBuffer = _allocateBuffer();
 					}
 				}
 			}
@@ -882,7 +1181,7 @@ namespace MSTD {
 					auto nextBuffer = _end._node + 1;
 					if (!*nextBuffer) {
 						// Allocate new buffer
-						*nextBuffer = _bufferAlloc.allocate(DEQUE_BUFFER_SIZE);
+						*nextBuffer = _allocateBuffer();
 					}
 				}
 			}
@@ -947,6 +1246,26 @@ namespace MSTD {
 			}
 		}
 
+		// Elements are neither moved nor copied at either end,
+		// so the new one is constructed in place right away
+		template<typename... Args>
+		void _emplaceAtBack(Args&&... args)
+		{
+			_checkCapacity(false);
+			_alloc.construct(_end._cur, MSTD::forward<Args>(args)...);
+			++_end;
+		}
+
+		template<typename... Args>
+		void _emplaceAtFront(Args&&... args)
+		{
+			_checkCapacity(true);
+			auto newBeg = _beg;
+			--newBeg;
+			_alloc.construct(newBeg._cur, MSTD::forward<Args>(args)...);
+			_beg = newBeg;
+		}
+
 		template<typename... Args>
 		Iterator _auxEmplace(ConstIterator pos, Args&&... args)
 		{
@@ -959,7 +1278,7 @@ namespace MSTD {
 				_copyForward(_beg, _beg + rawPos, _beg - 1);
 				// Insert new value
 				auto newPos = _beg + rawPos - 1;
-				_alloc.construct(newPos._cur, forward<Args>(args)...);
+				_alloc.construct(newPos._cur, MSTD::forward<Args>(args)...);
 				// Upadte begin iterator
 				--_beg;
 				return newPos;
@@ -970,31 +1289,51 @@ namespace MSTD {
 				auto nEnd = _end;
 				_copyBackward(_beg + rawPos, _end, _end + 1);
 				// Insert new value
-				_alloc.construct((_beg + rawPos)._cur, forward<Args>(args)...);
+				_alloc.construct((_beg + rawPos)._cur, MSTD::forward<Args>(args)...);
 				// Update end iterator
 				++_end;
 				return _beg + rawPos;
 			}
 		}
 
+		// Once erasing at the front or back moved {_beg} or {_end}
+		// off its node, release buffers beyond the room kept there,
+		// see _releaseBuffer. The room is the buffer the next push
+		// goes to, or what reserveFront()/reserveBack() asked for
 		void _shrinkCapacity(bool shrinkFront)
 		{
 			if (shrinkFront) {
-				auto preNode = _beg._node - 1;
-				if (*preNode) {
-					_bufferAlloc.deallocate(*preNode, DEQUE_BUFFER_SIZE);
-					*preNode = nullptr;
+				if (_beg._cur != _beg._first) {
+					// Still in the same buffer
+					return;
+				}
+				SizeType keep = _keptNodes(_reservedFront);
+				SizeType room = _beg._node - _map;
+				for (SizeType i = keep + 1; i <= room && *(_beg._node - i); ++i) {
+					_releaseBuffer(*(_beg._node - i));
+					*(_beg._node - i) = nullptr;
 				}
 			}
 			else {
-				auto postNode = _end._node + 1;
-				if (*postNode) {
-					_bufferAlloc.deallocate(*postNode, DEQUE_BUFFER_SIZE);
-					*postNode = nullptr;
+				if (_end._cur != _end._last - 1) {
+					return;
+				}
+				SizeType keep = _keptNodes(_reservedBack);
+				SizeType room = _map + _mapSize - 1 - _end._node;
+				for (SizeType i = keep + 1; i <= room && *(_end._node + i); ++i) {
+					_releaseBuffer(*(_end._node + i));
+					*(_end._node + i) = nullptr;
 				}
 			}
 		}
 
+		// Nodes next to the one in use needed to push {count}
+		// elements, one at least
+		static SizeType _keptNodes(SizeType count)
+		{
+			return count > _BLOCK_SIZE ? (count + _BLOCK_SIZE - 1) / _BLOCK_SIZE : 1;
+		}
+
 		Iterator _auxErase(ConstIterator pos)
 		{
 			DifferenceType rawPos = pos - _beg;
@@ -1013,8 +1352,8 @@ namespace MSTD {
 		}
 	};
 
-	template<typename T, typename Alloc>
-	bool operator==(const Deque<T, Alloc> &lhs, const Deque<T, Alloc> &rhs)
+	template<typename T, typename Alloc, size_t BlockSize>
+	bool operator==(const Deque<T, Alloc, BlockSize> &lhs, const Deque<T, Alloc, BlockSize> &rhs)
 	{
 		if (lhs.size() != rhs.size()) {
 			return false;
@@ -1029,14 +1368,14 @@ namespace MSTD {
 		return true;
 	}
 
-	template<typename T, typename Alloc>
-	bool operator!=(const Deque<T, Alloc> &lhs, const Deque<T, Alloc> &rhs)
+	template<typename T, typename Alloc, size_t BlockSize>
+	bool operator!=(const Deque<T, Alloc, BlockSize> &lhs, const Deque<T, Alloc, BlockSize> &rhs)
 	{
 		return !(lhs == rhs);
 	}
 
-	template<typename T, typename Alloc>
-	bool operator<(const Deque<T, Alloc> &lhs, const Deque<T, Alloc> &rhs)
+	template<typename T, typename Alloc, size_t BlockSize>
+	bool operator<(const Deque<T, Alloc, BlockSize> &lhs, const Deque<T, Alloc, BlockSize> &rhs)
 	{
 		auto lit = lhs.begin();
 		auto rit = rhs.begin();
@@ -1052,8 +1391,8 @@ namespace MSTD {
 		return lit == lhs.end() && rit != rhs.end();
 	}
 
-	template<typename T, typename Alloc>
-	bool operator<=(const Deque<T, Alloc> &lhs, const Deque<T, Alloc> &rhs)
+	template<typename T, typename Alloc, size_t BlockSize>
+	bool operator<=(const Deque<T, Alloc, BlockSize> &lhs, const Deque<T, Alloc, BlockSize> &rhs)
 	{
 		auto lit = lhs.begin();
 		auto rit = rhs.begin();
@@ -1069,20 +1408,20 @@ namespace MSTD {
 		return lit == lhs.end();
 	}
 
-	template<typename T, typename Alloc>
-	bool operator>(const Deque<T, Alloc> &lhs, const Deque<T, Alloc> &rhs)
+	template<typename T, typename Alloc, size_t BlockSize>
+	bool operator>(const Deque<T, Alloc, BlockSize> &lhs, const Deque<T, Alloc, BlockSize> &rhs)
 	{
 		return !(lhs <= rhs);
 	}
 
-	template<typename T, typename Alloc>
-	bool operator>=(const Deque<T, Alloc> &lhs, const Deque<T, Alloc> &rhs)
+	template<typename T, typename Alloc, size_t BlockSize>
+	bool operator>=(const Deque<T, Alloc, BlockSize> &lhs, const Deque<T, Alloc, BlockSize> &rhs)
 	{
 		return !(lhs < rhs);
 	}
 
-	template<typename T, typename Alloc>
-	void swap(Deque<T, alloc> &lhs, Deque<T, Alloc> &rhs) noexcept
+	template<typename T, typename Alloc, size_t BlockSize>
+	void swap(Deque<T, Alloc, BlockSize> &lhs, Deque<T, Alloc, BlockSize> &rhs) noexcept
 	{
 		lhs.swap(rhs);
 	}
@@ -0,0 +1,830 @@
+#pragma once
+
+// DynamicBitset header
+
+// Mini-STL header
+#include <Config/Config.h>
+#include <Alloc/Allocator.h>
+#include <Iterator/Iterator.h>
+#include <Container/Vector.h>
+
+// STL header and cpp standard header
+#include <initializer_list>
+#include <stdexcept>
+#include <cstdint>
+#include <cstring>
+
+namespace MSTD {
+
+	// Word of bits in DynamicBitset
+	using _BitWord = uint64_t;
+
+	constexpr size_t _BITS_PER_WORD = 64;
+
+	// Number of set bits in {w}
+	inline size_t _popCount(_BitWord w) noexcept
+	{
+#if defined(__GNUC__) && defined(__POPCNT__)
+		return static_cast<size_t>(__builtin_popcountll(w));
+#else
+		// Count in parallel, bits of every 2, 4 and 8 bits
+		// first, then add up all bytes by a multiply
+		w = w - ((w >> 1) & 0x5555555555555555ULL);
+		w = (w & 0x3333333333333333ULL) + ((w >> 2) & 0x3333333333333333ULL);
+		w = (w + (w >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+		return static_cast<size_t>((w * 0x0101010101010101ULL) >> 56);
+#endif
+	}
+
+	// Index of the lowest set bit in {w}, which isn't 0
+	inline size_t _countTrailingZeros(_BitWord w) noexcept
+	{
+#if defined(__GNUC__)
+		return static_cast<size_t>(__builtin_ctzll(w));
+#else
+		size_t ret = 0;
+		while (!(w & 1)) {
+			w >>= 1;
+			++ret;
+		}
+		return ret;
+#endif
+	}
+
+	// Proxy to a bit in DynamicBitset
+	class _BitReference
+	{
+	public:
+		_BitReference(_BitWord *word, _BitWord mask) noexcept :
+			_word(word),
+			_mask(mask)
+		{}
+
+		_BitReference(const _BitReference &) = default;
+
+		operator bool() const noexcept
+		{
+			return (*_word & _mask) != 0;
+		}
+
+		bool operator~() const noexcept
+		{
+			return (*_word & _mask) == 0;
+		}
+
+		_BitReference& operator=(bool val) noexcept
+		{
+			if (val) {
+				*_word |= _mask;
+			}
+			else {
+				*_word &= ~_mask;
+			}
+			return *this;
+		}
+
+		// Assign the bit referred to, not the proxy
+		_BitReference& operator=(const _BitReference &that) noexcept
+		{
+			return *this = static_cast<bool>(that);
+		}
+
+		_BitReference& flip() noexcept
+		{
+			*_word ^= _mask;
+			return *this;
+		}
+
+	private:
+		_BitWord *_word;
+		_BitWord _mask;
+	};
+
+	// Bits referred to are swapped
+	inline void swap(_BitReference lhs, _BitReference rhs) noexcept
+	{
+		bool tmp = lhs;
+		lhs = rhs;
+		rhs = tmp;
+	}
+
+	// Const iterator of DynamicBitset.
+	// Points to bit {_offset} of word {_word}
+	class _BitConstIterator
+	{
+	public:
+		using IteratorCategory = RandomAccessIteratorTag;
+		using DifferenceType = ptrdiff_t;
+		using ValueType = bool;
+		using Pointer = void;
+		using Reference = bool;
+
+		_BitConstIterator() noexcept :
+			_word(nullptr),
+			_offset(0)
+		{}
+
+		_BitConstIterator(const _BitWord *word, size_t offset) noexcept :
+			_word(word),
+			_offset(offset)
+		{}
+
+		bool operator*() const noexcept
+		{
+			return (*_word >> _offset) & 1;
+		}
+
+		bool operator[](DifferenceType diff) const noexcept
+		{
+			return *(*this + diff);
+		}
+
+		_BitConstIterator& operator++() noexcept
+		{
+			if (++_offset == _BITS_PER_WORD) {
+				_offset = 0;
+				++_word;
+			}
+			return *this;
+		}
+
+		_BitConstIterator operator++(int) noexcept
+		{
+			auto tmp = *this;
+			++*this;
+			return tmp;
+		}
+
+		_BitConstIterator& operator--() noexcept
+		{
+			if (_offset-- == 0) {
+				_offset = _BITS_PER_WORD - 1;
+				--_word;
+			}
+			return *this;
+		}
+
+		_BitConstIterator operator--(int) noexcept
+		{
+			auto tmp = *this;
+			--*this;
+			return tmp;
+		}
+
+		_BitConstIterator& operator+=(DifferenceType diff) noexcept
+		{
+			_advance(diff);
+			return *this;
+		}
+
+		_BitConstIterator operator+(DifferenceType diff) const noexcept
+		{
+			auto tmp = *this;
+			return tmp += diff;
+		}
+
+		_BitConstIterator& operator-=(DifferenceType diff) noexcept
+		{
+			_advance(-diff);
+			return *this;
+		}
+
+		_BitConstIterator operator-(DifferenceType diff) const noexcept
+		{
+			auto tmp = *this;
+			return tmp -= diff;
+		}
+
+		// Bits from {that} to this one
+		DifferenceType distanceFrom(const _BitConstIterator &that) const noexcept
+		{
+			return (_word - that._word) * static_cast<DifferenceType>(_BITS_PER_WORD) +
+				static_cast<DifferenceType>(_offset) - static_cast<DifferenceType>(that._offset);
+		}
+
+	protected:
+		void _advance(DifferenceType diff) noexcept
+		{
+			auto bits = static_cast<DifferenceType>(_offset) + diff;
+			auto perWord = static_cast<DifferenceType>(_BITS_PER_WORD);
+			// Round down for bits before this word
+			auto words = bits >= 0 ? bits / perWord : -((perWord - 1 - bits) / perWord);
+			_word += words;
+			_offset = static_cast<size_t>(bits - words * perWord);
+		}
+
+		const _BitWord *_word;
+		size_t _offset;
+	};
+
+	inline bool operator==(const _BitConstIterator &lhs, const _BitConstIterator &rhs) noexcept
+	{
+		return lhs.distanceFrom(rhs) == 0;
+	}
+
+	inline bool operator!=(const _BitConstIterator &lhs, const _BitConstIterator &rhs) noexcept
+	{
+		return !(lhs == rhs);
+	}
+
+	inline bool operator<(const _BitConstIterator &lhs, const _BitConstIterator &rhs) noexcept
+	{
+		return lhs.distanceFrom(rhs) < 0;
+	}
+
+	inline bool operator<=(const _BitConstIterator &lhs, const _BitConstIterator &rhs) noexcept
+	{
+		return lhs.distanceFrom(rhs) <= 0;
+	}
+
+	inline bool operator>(const _BitConstIterator &lhs, const _BitConstIterator &rhs) noexcept
+	{
+		return lhs.distanceFrom(rhs) > 0;
+	}
+
+	inline bool operator>=(const _BitConstIterator &lhs, const _BitConstIterator &rhs) noexcept
+	{
+		return lhs.distanceFrom(rhs) >= 0;
+	}
+
+	inline ptrdiff_t operator-(const _BitConstIterator &lhs, const _BitConstIterator &rhs) noexcept
+	{
+		return lhs.distanceFrom(rhs);
+	}
+
+	// Iterator of DynamicBitset, dereferenced to a proxy
+	class _BitIterator : public _BitConstIterator
+	{
+	public:
+		using Reference = _BitReference;
+
+		_BitIterator() noexcept = default;
+
+		_BitIterator(_BitWord *word, size_t offset) noexcept :
+			_BitConstIterator(word, offset)
+		{}
+
+		_BitReference operator*() const noexcept
+		{
+			return _BitReference(const_cast<_BitWord*>(_word), _BitWord(1) << _offset);
+		}
+
+		_BitReference operator[](DifferenceType diff) const noexcept
+		{
+			return *(*this + diff);
+		}
+
+		_BitIterator& operator++() noexcept
+		{
+			_BitConstIterator::operator++();
+			return *this;
+		}
+
+		_BitIterator operator++(int) noexcept
+		{
+			auto tmp = *this;
+			++*this;
+			return tmp;
+		}
+
+		_BitIterator& operator--() noexcept
+		{
+			_BitConstIterator::operator--();
+			return *this;
+		}
+
+		_BitIterator operator--(int) noexcept
+		{
+			auto tmp = *this;
+			--*this;
+			return tmp;
+		}
+
+		_BitIterator& operator+=(DifferenceType diff) noexcept
+		{
+			_advance(diff);
+			return *this;
+		}
+
+		_BitIterator operator+(DifferenceType diff) const noexcept
+		{
+			auto tmp = *this;
+			return tmp += diff;
+		}
+
+		_BitIterator& operator-=(DifferenceType diff) noexcept
+		{
+			_advance(-diff);
+			return *this;
+		}
+
+		_BitIterator operator-(DifferenceType diff) const noexcept
+		{
+			auto tmp = *this;
+			return tmp -= diff;
+		}
+	};
+
+	// DynamicBitset
+	// Sequence of bits packed in 64-bit words, resizable
+	// like Vector<bool> but an eighth of its size. Bits are
+	// counted, searched and combined a word at a time.
+	// Bits beyond size() in the last word are always 0.
+	// Combining bitsets of different sizes throws
+	// std::invalid_argument
+	template<
+		typename Alloc = Allocator<_BitWord> // Allocator of words
+	> class DynamicBitset
+	{
+	public:
+		using AllocatorType = Alloc;
+		using WordType = _BitWord;
+		using SizeType = size_t;
+		using DifferenceType = ptrdiff_t;
+		using ValueType = bool;
+		using Reference = _BitReference;
+		using ConstReference = bool;
+		using Iterator = _BitIterator;
+		using ConstIterator = _BitConstIterator;
+		using ReverseIterator = MSTD::ReverseIterator<Iterator>;
+		using ConstReverseIterator = MSTD::ReverseIterator<ConstIterator>;
+
+		// Returned by findFirst() and findNext() if no
+		// bit is set
+		static constexpr SizeType npos = static_cast<SizeType>(-1);
+
+		/////////////////////////////////////
+		//
+		//	Constructors and destructor
+		//
+		/////////////////////////////////////
+
+		DynamicBitset() noexcept(noexcept(Alloc())) :
+			_words(),
+			_size(0)
+		{}
+
+		explicit DynamicBitset(const Alloc &alloc) :
+			_words(alloc),
+			_size(0)
+		{}
+
+		// {count} bits of {val}
+		explicit DynamicBitset(SizeType count, bool val = false, const Alloc &alloc = Alloc()) :
+			_words(_wordsFor(count), val ? ~WordType(0) : WordType(0), alloc),
+			_size(count)
+		{
+			_clearUnused();
+		}
+
+		DynamicBitset(std::initializer_list<bool> li, const Alloc &alloc = Alloc()) :
+			DynamicBitset(li.size(), false, alloc)
+		{
+			SizeType pos = 0;
+			for (bool bit : li) {
+				if (bit) {
+					set(pos);
+				}
+				++pos;
+			}
+		}
+
+		AllocatorType getAllocator() const
+		{
+			return _words.getAllocator();
+		}
+
+		/////////////////////////////////////
+		//
+		//			Element access
+		//
+		/////////////////////////////////////
+
+		Reference operator[](SizeType pos) noexcept
+		{
+			return Reference(&_words[pos / _BITS_PER_WORD], _maskOf(pos));
+		}
+
+		ConstReference operator[](SizeType pos) const noexcept
+		{
+			return (_words[pos / _BITS_PER_WORD] & _maskOf(pos)) != 0;
+		}
+
+		bool test(SizeType pos) const
+		{
+			if (pos >= _size) {
+				throw std::out_of_range("Invalid index to access");
+			}
+			return (*this)[pos];
+		}
+
+		// Words holding the bits, the lowest bit of the
+		// first word is bit 0
+		const WordType* data() const noexcept
+		{
+			return _words.data();
+		}
+
+		SizeType wordCount() const noexcept
+		{
+			return _words.size();
+		}
+
+		/////////////////////////////////////
+		//
+		//			 Iterators
+		//
+		/////////////////////////////////////
+
+		Iterator begin() noexcept
+		{
+			return Iterator(_words.data(), 0);
+		}
+
+		ConstIterator begin() const noexcept
+		{
+			return ConstIterator(_words.data(), 0);
+		}
+
+		ConstIterator cbegin() const noexcept
+		{
+			return begin();
+		}
+
+		Iterator end() noexcept
+		{
+			return begin() + static_cast<DifferenceType>(_size);
+		}
+
+		ConstIterator end() const noexcept
+		{
+			return begin() + static_cast<DifferenceType>(_size);
+		}
+
+		ConstIterator cend() const noexcept
+		{
+			return end();
+		}
+
+		ReverseIterator rbegin() noexcept
+		{
+			return ReverseIterator(end());
+		}
+
+		ConstReverseIterator rbegin() const noexcept
+		{
+			return ConstReverseIterator(end());
+		}
+
+		ReverseIterator rend() noexcept
+		{
+			return ReverseIterator(begin());
+		}
+
+		ConstReverseIterator rend() const noexcept
+		{
+			return ConstReverseIterator(begin());
+		}
+
+		/////////////////////////////////////
+		//
+		//			 Capacity
+		//
+		/////////////////////////////////////
+
+		bool empty() const noexcept
+		{
+			return _size == 0;
+		}
+
+		SizeType size() const noexcept
+		{
+			return _size;
+		}
+
+		SizeType capacity() const noexcept
+		{
+			return _words.capacity() * _BITS_PER_WORD;
+		}
+
+		void reserve(SizeType bits)
+		{
+			_words.reserve(_wordsFor(bits));
+		}
+
+		void shrinkToFit()
+		{
+			_words.shrinkToFit();
+		}
+
+		/////////////////////////////////////
+		//
+		//			 Modifiers
+		//
+		/////////////////////////////////////
+
+		void clear() noexcept
+		{
+			_words.erase(_words.begin(), _words.end());
+			_size = 0;
+		}
+
+		// New bits are {val}
+		void resize(SizeType count, bool val = false)
+		{
+			if (val && count > _size && _size % _BITS_PER_WORD != 0) {
+				_words.back() |= ~WordType(0) << (_size % _BITS_PER_WORD);
+			}
+			_words.resize(_wordsFor(count), val ? ~WordType(0) : WordType(0));
+			_size = count;
+			_clearUnused();
+		}
+
+		void pushBack(bool val)
+		{
+			if (_size % _BITS_PER_WORD == 0) {
+				_words.pushBack(WordType(0));
+			}
+			if (val) {
+				_words.back() |= _maskOf(_size);
+			}
+			++_size;
+		}
+
+		void popBack() noexcept
+		{
+			--_size;
+			if (_size % _BITS_PER_WORD == 0) {
+				_words.popBack();
+			}
+			else {
+				_words.back() &= ~_maskOf(_size);
+			}
+		}
+
+		DynamicBitset& set(SizeType pos, bool val = true) noexcept
+		{
+			(*this)[pos] = val;
+			return *this;
+		}
+
+		// Set all bits
+		DynamicBitset& set() noexcept
+		{
+			for (auto &w : _words) {
+				w = ~WordType(0);
+			}
+			_clearUnused();
+			return *this;
+		}
+
+		DynamicBitset& reset(SizeType pos) noexcept
+		{
+			_words[pos / _BITS_PER_WORD] &= ~_maskOf(pos);
+			return *this;
+		}
+
+		// Reset all bits
+		DynamicBitset& reset() noexcept
+		{
+			for (auto &w : _words) {
+				w = 0;
+			}
+			return *this;
+		}
+
+		DynamicBitset& flip(SizeType pos) noexcept
+		{
+			_words[pos / _BITS_PER_WORD] ^= _maskOf(pos);
+			return *this;
+		}
+
+		// Flip all bits
+		DynamicBitset& flip() noexcept
+		{
+			for (auto &w : _words) {
+				w = ~w;
+			}
+			_clearUnused();
+			return *this;
+		}
+
+		void swap(DynamicBitset &that) noexcept
+		{
+			_words.swap(that._words);
+			using std::swap;
+			swap(_size, that._size);
+		}
+
+		/////////////////////////////////////
+		//
+		//		   Bulk operations
+		//
+		/////////////////////////////////////
+
+		// Loops below are plain loops over words, so the
+		// compiler can vectorize them
+
+		DynamicBitset& operator&=(const DynamicBitset &that)
+		{
+			_checkSize(that);
+			auto dest = _words.data();
+			auto src = that._words.data();
+			for (SizeType i = 0, n = _words.size(); i < n; ++i) {
+				dest[i] &= src[i];
+			}
+			return *this;
+		}
+
+		DynamicBitset& operator|=(const DynamicBitset &that)
+		{
+			_checkSize(that);
+			auto dest = _words.data();
+			auto src = that._words.data();
+			for (SizeType i = 0, n = _words.size(); i < n; ++i) {
+				dest[i] |= src[i];
+			}
+			return *this;
+		}
+
+		DynamicBitset& operator^=(const DynamicBitset &that)
+		{
+			_checkSize(that);
+			auto dest = _words.data();
+			auto src = that._words.data();
+			for (SizeType i = 0, n = _words.size(); i < n; ++i) {
+				dest[i] ^= src[i];
+			}
+			return *this;
+		}
+
+		// Reset bits set in {that}
+		DynamicBitset& andNot(const DynamicBitset &that)
+		{
+			_checkSize(that);
+			auto dest = _words.data();
+			auto src = that._words.data();
+			for (SizeType i = 0, n = _words.size(); i < n; ++i) {
+				dest[i] &= ~src[i];
+			}
+			return *this;
+		}
+
+		DynamicBitset operator~() const
+		{
+			DynamicBitset ret(*this);
+			ret.flip();
+			return ret;
+		}
+
+		/////////////////////////////////////
+		//
+		//			  Queries
+		//
+		/////////////////////////////////////
+
+		// Number of set bits
+		SizeType count() const noexcept
+		{
+			SizeType ret = 0;
+			for (auto w : _words) {
+				ret += _popCount(w);
+			}
+			return ret;
+		}
+
+		bool any() const noexcept
+		{
+			for (auto w : _words) {
+				if (w) {
+					return true;
+				}
+			}
+			return false;
+		}
+
+		bool none() const noexcept
+		{
+			return !any();
+		}
+
+		bool all() const noexcept
+		{
+			auto full = _size / _BITS_PER_WORD;
+			for (SizeType i = 0; i < full; ++i) {
+				if (_words[i] != ~WordType(0)) {
+					return false;
+				}
+			}
+			return _size % _BITS_PER_WORD == 0 ||
+				_words.back() == ~(~WordType(0) << (_size % _BITS_PER_WORD));
+		}
+
+		// Position of the first set bit, npos if none
+		SizeType findFirst() const noexcept
+		{
+			return _findFrom(0);
+		}
+
+		// Position of the first set bit after {pos},
+		// npos if none
+		SizeType findNext(SizeType pos) const noexcept
+		{
+			return pos + 1 < _size ? _findFrom(pos + 1) : npos;
+		}
+
+	private:
+		static SizeType _wordsFor(SizeType bits) noexcept
+		{
+			return (bits + _BITS_PER_WORD - 1) / _BITS_PER_WORD;
+		}
+
+		static WordType _maskOf(SizeType pos) noexcept
+		{
+			return WordType(1) << (pos % _BITS_PER_WORD);
+		}
+
+		// Keep bits beyond size() in the last word 0
+		void _clearUnused() noexcept
+		{
+			if (_size % _BITS_PER_WORD != 0) {
+				_words.back() &= ~(~WordType(0) << (_size % _BITS_PER_WORD));
+			}
+		}
+
+		void _checkSize(const DynamicBitset &that) const
+		{
+			if (_size != that._size) {
+				throw std::invalid_argument("Bitsets of different sizes");
+			}
+		}
+
+		SizeType _findFrom(SizeType pos) const noexcept
+		{
+			if (pos >= _size) {
+				return npos;
+			}
+			auto index = pos / _BITS_PER_WORD;
+			auto w = _words[index] & (~WordType(0) << (pos % _BITS_PER_WORD));
+			auto n = _words.size();
+			while (!w) {
+				if (++index == n) {
+					return npos;
+				}
+				w = _words[index];
+			}
+			return index * _BITS_PER_WORD + _countTrailingZeros(w);
+		}
+
+		Vector<WordType, Alloc> _words;
+		SizeType _size;
+	};
+
+	template<typename Alloc>
+	constexpr typename DynamicBitset<Alloc>::SizeType DynamicBitset<Alloc>::npos;
+
+	template<typename Alloc>
+	inline
+	bool operator==(const DynamicBitset<Alloc> &lhs, const DynamicBitset<Alloc> &rhs) noexcept
+	{
+		return lhs.size() == rhs.size() && (lhs.empty() ||
+			std::memcmp(lhs.data(), rhs.data(), lhs.wordCount() * sizeof(_BitWord)) == 0);
+	}
+
+	template<typename Alloc>
+	inline
+	bool operator!=(const DynamicBitset<Alloc> &lhs, const DynamicBitset<Alloc> &rhs) noexcept
+	{
+		return !(lhs == rhs);
+	}
+
+	template<typename Alloc>
+	DynamicBitset<Alloc> operator&(const DynamicBitset<Alloc> &lhs, const DynamicBitset<Alloc> &rhs)
+	{
+		DynamicBitset<Alloc> ret(lhs);
+		ret &= rhs;
+		return ret;
+	}
+
+	template<typename Alloc>
+	DynamicBitset<Alloc> operator|(const DynamicBitset<Alloc> &lhs, const DynamicBitset<Alloc> &rhs)
+	{
+		DynamicBitset<Alloc> ret(lhs);
+		ret |= rhs;
+		return ret;
+	}
+
+	template<typename Alloc>
+	DynamicBitset<Alloc> operator^(const DynamicBitset<Alloc> &lhs, const DynamicBitset<Alloc> &rhs)
+	{
+		DynamicBitset<Alloc> ret(lhs);
+		ret ^= rhs;
+		return ret;
+	}
+
+	template<typename Alloc>
+	void swap(DynamicBitset<Alloc> &lhs, DynamicBitset<Alloc> &rhs) noexcept
+	{
+		lhs.swap(rhs);
+	}
+}
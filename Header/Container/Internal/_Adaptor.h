@@ -0,0 +1,43 @@
+#pragma once
+
+// Internal use
+// Helpers of container adaptors
+
+// Mini-STL header
+#include <TypeInfo/TypeTraits.h>
+#include <Utility/forward.h>
+
+// STL header and cpp standard header
+#include <stdexcept>
+
+namespace MSTD {
+
+	template<typename Container, typename... Args>
+	void _auxAdaptorEmplaceBack(Container &c, falseType, Args&&... args)
+	{
+		c.emplaceBack(MSTD::forward<Args>(args)...);
+	}
+
+	// Containers of fixed capacity, e.g. StaticVector, return
+	// false when full, adaptors can't pass that on so they throw
+	template<typename Container, typename... Args>
+	void _auxAdaptorEmplaceBack(Container &c, trueType, Args&&... args)
+	{
+		if (!c.emplaceBack(MSTD::forward<Args>(args)...)) {
+			throw std::length_error("Container of adaptor is full");
+		}
+	}
+
+	// Construct an element at the back of {c}
+	template<typename Container, typename... Args>
+	void _adaptorEmplaceBack(Container &c, Args&&... args)
+	{
+		_auxAdaptorEmplaceBack(c,
+			typename conditional<
+				isSame<decltype(c.emplaceBack(MSTD::forward<Args>(args)...)), bool>::value,
+				trueType, falseType
+			>::type(),
+			MSTD::forward<Args>(args)...);
+	}
+
+}
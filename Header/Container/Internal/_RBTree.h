@@ -41,7 +41,12 @@ namespace MSTD {
 		template<typename NodeAlloc>
 		static _NodePtr createNode(NodeAlloc &alloc)
 		{
-			_NodePtr pNode = AllocatorTraits<NodeAlloc>::allocate(alloc, 1);
+			return initNode(AllocatorTraits<NodeAlloc>::allocate(alloc, 1));
+		}
+
+		// Initialize links of an allocated node
+		static _NodePtr initNode(_NodePtr pNode)
+		{
 			pNode->_left = pNode->_right = pNode->_parent = pNode;
 			pNode->_color = RED;
 			pNode->_isNil = false;
@@ -294,12 +299,18 @@ namespace MSTD {
 		using ConstReverseIterator = MSTD::ReverseIterator<ConstIterator>;
 		using ReverseIterator = MSTD::ReverseIterator<Iterator>;
 
-		using AllocatorType = typename _ConfigParam::AllocatorType;
-		using _NodeAlloc = Allocator<_TreeNode<ValueType>>;
-
 		using _Node = _TreeNode<ValueType>;
 		using _NodePtr = _TreeNode<ValueType>*;
 
+		using AllocatorType = typename _ConfigParam::AllocatorType;
+		using _NodeAlloc = typename AllocatorTraits<AllocatorType>::template rebind<_Node>;
+		// Nodes needn't be visited one by one on clean up
+		using _BulkRelease = typename conditional<
+			isTriviallyDestructible<ValueType>::value &&
+			AllocatorTraits<_NodeAlloc>::IsBulkReleased::value,
+			trueType, falseType
+		>::type;
+
 		using _PairIB = std::pair<Iterator, bool>;
 		using _PairCB = std::pair<ConstIterator, bool>;
 		using _RangePtr = std::pair<_NodePtr, _NodePtr>;
@@ -313,20 +324,15 @@ namespace MSTD {
 		////////////////////////////////////
 
 		_RBTree() :
-			_BaseTree<_ConfigParam, _Node>(),
-			_comp(),
-			_dataAl(),
-			_nodeAl()
-		{
-			_initialize();
-		}
+			_RBTree(KeyCompare(), AllocatorType())
+		{}
 
 		explicit _RBTree(const KeyCompare &comp, 
 			const AllocatorType &alloc = AllocatorType()) :
 			_BaseTree<_ConfigParam, _Node>(),
 			_comp(comp),
 			_dataAl(alloc),
-			_nodeAl()
+			_nodeAl(alloc)
 		{
 			_initialize();
 		}
@@ -341,37 +347,42 @@ namespace MSTD {
 				const AllocatorType &alloc = AllocatorType()) :
 			_RBTree(comp, alloc)
 		{
-			while (first != last) {
-				_auxInsert(*first++);
-			}
+			_insertRange(first, last);
 		}
 
 		_RBTree(const _RBTree &that) :
 			_RBTree(that._comp, that._dataAl)
 		{
-			this->_root() = this->_copyTree(that._root());
-			this->_root()->_parent = this->_NIL();
-			this->_size = that._size;
-			if (!this->_root()->_isNil) {
-				// Set left most and right most
-				this->_leftMost() = this->_min(this->_root());
-				this->_rightMost() = this->_max(this->_root());
-			}
+			_assignTree(that);
 		}
 
 		_RBTree(_RBTree &&that) noexcept :
 			_BaseTree<_ConfigParam, _Node>(),
-			_comp(move(that._comp)),
-			_dataAl(move(that._dataAl)),
-			_nodeAl(move(that._nodeAl))
+			_comp(MSTD::move(that._comp)),
+			_dataAl(MSTD::move(that._dataAl)),
+			_nodeAl(MSTD::move(that._nodeAl))
 		{
-			_initialize();
-			this->_head = move(that._head);
-			this->_size = move(that._size);
+			this->_head = MSTD::move(that._head);
+			this->_size = MSTD::move(that._size);
 			that._head = nullptr;
 			that._size = 0;
 		}
 
+		// Steal the nodes of {that} only if they are
+		// released by {alloc}, otherwise copy the tree
+		_RBTree(_RBTree &&that, const AllocatorType &alloc) :
+			_RBTree(that._comp, alloc)
+		{
+			if (_dataAl == that._dataAl) {
+				using std::swap;
+				swap(this->_head, that._head);
+				swap(this->_size, that._size);
+			}
+			else {
+				_assignTree(that);
+			}
+		}
+
 		_RBTree(std::initializer_list<ValueType> il,
 				const KeyCompare &comp = KeyCompare(),
 				const AllocatorType &alloc = AllocatorType()) :
@@ -387,35 +398,33 @@ namespace MSTD {
 
 		_RBTree& operator=(const _RBTree &that)
 		{
-			if (this != addressof(that)) {
-				clear();
+			if (this != MSTD::addressof(that)) {
+				// Allocators are kept
 				this->_comp = that._comp;
-				this->_dataAl = that._dataAl;
-				this->_nodeAl = that._nodeAl;
-				this->_root() = this->_copyTree(that._root());
-				this->_root()->_parent = this->_NIL();
-				this->_size = that._size;
-				if (!this->_root()->_isNil) {
-					// Set left most and right most
-					this->_leftMost() = this->_min(this->_root());
-					this->_rightMost() = this->_max(this->_root());
-				}
+				_assignTree(that);
 			}
 			return *this;
 		}
 
-		_RBTree& operator=(_RBTree &&that) noexcept
+		// Allocators are kept, nodes of {that} are stolen
+		// only if both allocators are equal
+		_RBTree& operator=(_RBTree &&that)
 		{
-			if (this != addressof(that)) {
-				clear();
-				// Stealing tree
-				this->_comp = move(that._comp);
-				this->_dataAl = move(that._dataAl);
-				this->_nodeAl = move(that._nodeAl);
-				this->_head = move(that._head);
-				this->_size = move(that._size);
-				that._head = nullptr;
-				that._size = 0;
+			if (this != MSTD::addressof(that)) {
+				this->_comp = MSTD::move(that._comp);
+				if (_dataAl == that._dataAl) {
+					// Stealing tree
+					if (this->_head) {
+						_destroy();
+					}
+					this->_head = MSTD::move(that._head);
+					this->_size = MSTD::move(that._size);
+					that._head = nullptr;
+					that._size = 0;
+				}
+				else {
+					_assignTree(that);
+				}
 			}
 			return *this;
 		}
@@ -519,7 +528,7 @@ namespace MSTD {
 
 		void clear() noexcept
 		{
-			_cleanUp(this->_root());
+			_auxCleanUp(_BulkRelease());
 			// Reset root to NIL
 			this->_root() = this->_NIL();
 			this->_leftMost() = this->_NIL();
@@ -561,9 +570,7 @@ namespace MSTD {
 		template<typename InputIt>
 		void insert(InputIt first, InputIt last)
 		{
-			while (first != last) {
-				insert(*first++);
-			}
+			_insertRange(first, last);
 		}
 
 		void insert(std::initializer_list<ValueType> il)
@@ -575,7 +582,7 @@ namespace MSTD {
 		_PairIB emplace(Args&&... args)
 		{
 			_NodePtr insertNode = _Node::createNode(this->_nodeAl);
-			_Node::constructNode(this->_dataAl, insertNode, forward<Args>(args)...);
+			_Node::constructNode(this->_dataAl, insertNode, MSTD::forward<Args>(args)...);
 
 			_NodePtr tryNode = this->_root();
 			_NodePtr pos = this->_head;
@@ -629,12 +636,18 @@ namespace MSTD {
 		void swap(_RBTree &that) noexcept
 		{
 			using std::swap;
-			swap(_head, that._head);
-			swap(_size, that._size);
+			swap(this->_head, that._head);
+			swap(this->_size, that._size);
+			swap(_comp, that._comp);
 			swap(_dataAl, that._dataAl);
 			swap(_nodeAl, that._nodeAl);
 		}
 
+		AllocatorType getAllocator() const
+		{
+			return _dataAl;
+		}
+
 		/////////////////////////////////////
 		//
 		//			Lookup
@@ -768,8 +781,9 @@ namespace MSTD {
 			this->_root()->_color = _Node::BLACK;
 		}
 
-		// Insert the val according to keyCompare
-		_PairIB _auxInsert(const ValueType& val)
+		// Insert the val according to keyCompare, new node
+		// is taken from {spare} if given
+		_PairIB _auxInsert(const ValueType& val, _NodeBatch<_NodeAlloc> *spare = nullptr)
 		{
 			_NodePtr tryNode = this->_root();
 			_NodePtr pos = this->_head;
@@ -784,7 +798,7 @@ namespace MSTD {
 			}
 			
 			if (this->_MULTI) {
-				_NodePtr insertNode = _Node::createNode(this->_nodeAl);
+				_NodePtr insertNode = _newNode(spare);
 				_Node::constructNode(this->_dataAl, insertNode, val);
 				this->_insertAt(insertNode, pos, addLeft);
 				_insertionRebalance(insertNode);
@@ -797,7 +811,7 @@ namespace MSTD {
 				if (addLeft) {
 					if (where._cur == this->_leftMost()) {
 						// No more predecessor nodes
-						_NodePtr insertNode = _Node::createNode(this->_nodeAl);
+						_NodePtr insertNode = _newNode(spare);
 						_Node::constructNode(this->_dataAl, insertNode, val);
 						this->_insertAt(insertNode, pos, addLeft);
 						_insertionRebalance(insertNode);
@@ -810,7 +824,7 @@ namespace MSTD {
 				}
 				if (_comp(_getKeyFromNode(where._cur), _getKeyFromVal(val))) {
 					// Unique in the tree
-					_NodePtr insertNode = _Node::createNode(this->_nodeAl);
+					_NodePtr insertNode = _newNode(spare);
 					_Node::constructNode(this->_dataAl, insertNode, val);
 					this->_insertAt(insertNode, pos, addLeft);
 					_insertionRebalance(insertNode);
@@ -824,7 +838,7 @@ namespace MSTD {
 		}
 
 		// Insert the val according to keyCompare
-		_PairIB _auxInsert(ValueType&& val)
+		_PairIB _auxInsert(ValueType&& val, _NodeBatch<_NodeAlloc> *spare = nullptr)
 		{
 			_NodePtr tryNode = this->_root();
 			_NodePtr pos = this->_head;
@@ -839,7 +853,7 @@ namespace MSTD {
 			}
 
 			if (this->_MULTI) {
-				_NodePtr insertNode = _Node::createNode(this->_nodeAl);
+				_NodePtr insertNode = _newNode(spare);
 				_Node::constructNode(this->_dataAl, insertNode, MSTD::move(val));
 				this->_insertAt(insertNode, pos, addLeft);
 				_insertionRebalance(insertNode);
@@ -852,7 +866,7 @@ namespace MSTD {
 				if (addLeft) {
 					if (where._cur == this->_leftMost()) {
 						// No more predecessor nodes
-						_NodePtr insertNode = _Node::createNode(this->_nodeAl);
+						_NodePtr insertNode = _newNode(spare);
 						_Node::constructNode(this->_dataAl, insertNode, MSTD::move(val));
 						this->_insertAt(insertNode, pos, addLeft);
 						_insertionRebalance(insertNode);
@@ -865,7 +879,7 @@ namespace MSTD {
 				}
 				if (_comp(_getKeyFromNode(where._cur), _getKeyFromVal(val))) {
 					// Unique in the tree
-					_NodePtr insertNode = _Node::createNode(this->_nodeAl);
+					_NodePtr insertNode = _newNode(spare);
 					_Node::constructNode(this->_dataAl, insertNode, MSTD::move(val));
 					this->_insertAt(insertNode, pos, addLeft);
 					_insertionRebalance(insertNode);
@@ -878,6 +892,28 @@ namespace MSTD {
 			}
 		}
 
+		// Take a node from {spare} if any, or allocate
+		// a new one
+		_NodePtr _newNode(_NodeBatch<_NodeAlloc> *spare)
+		{
+			if (spare) {
+				return _Node::initNode(spare->take());
+			}
+			return _Node::createNode(this->_nodeAl);
+		}
+
+		// Insert elements of [first, last), nodes of a 
+		// range with known length are allocated in one batch
+		template<typename InputIt>
+		void _insertRange(InputIt first, InputIt last)
+		{
+			_NodeBatch<_NodeAlloc> spare(this->_nodeAl);
+			spare.reserve(first, last);
+			for (; first != last; ++first) {
+				_auxInsert(*first, &spare);
+			}
+		}
+
 		_NodePtr _copyTree(_NodePtr root)
 		{
 			if (root->_isNil) {
@@ -899,25 +935,57 @@ namespace MSTD {
 			return newRoot;
 		}
 
-		// Clean up subtree
-		void _cleanUp(_NodePtr root) noexcept
+		// Clean up subtree, nodes are given to {spare}
+		void _cleanUp(_NodePtr root, _NodeBatch<_NodeAlloc> &spare) noexcept
 		{
 			if (!root->_isNil) {
 				// Destroy left and right subtrees
-				_cleanUp(root->_left);
-				_cleanUp(root->_right);
+				_cleanUp(root->_left, spare);
+				_cleanUp(root->_right, spare);
 				// Destroy current node
 				_Node::destroyNode(this->_dataAl, root);
-				_Node::freeNode(this->_nodeAl, root);
+				spare.give(root);
 				--this->_size;
 			}
 		}
 
+		void _auxCleanUp(trueType) noexcept
+		{
+			// no-op, nodes are released with the allocator
+		}
+
+		void _auxCleanUp(falseType) noexcept
+		{
+			// Nodes are deallocated in one batch
+			_NodeBatch<_NodeAlloc> spare(this->_nodeAl);
+			_cleanUp(this->_root(), spare);
+		}
+
 		void _destroy()
 		{
-			_cleanUp(this->_root());
+			_auxCleanUp(_BulkRelease());
 			// Free head node
 			_Node::freeNode(this->_nodeAl, this->_head);
+			this->_head = nullptr;
+		}
+
+		// Replace the tree with a copy of {that}
+		void _assignTree(const _RBTree &that)
+		{
+			if (this->_head) {
+				clear();
+			}
+			else {
+				_initialize();
+			}
+			this->_root() = this->_copyTree(that._root());
+			this->_root()->_parent = this->_NIL();
+			this->_size = that._size;
+			if (!this->_root()->_isNil) {
+				// Set left most and right most
+				this->_leftMost() = this->_min(this->_root());
+				this->_rightMost() = this->_max(this->_root());
+			}
 		}
 
 		void _deleteRebalance(_NodePtr fix, _NodePtr fixParent)
@@ -980,7 +1048,7 @@ namespace MSTD {
 						if (sibling->_left->_color == _Node::BLACK) {
 							// Transform to case 4
 							std::swap(sibling->_color, sibling->_right->_color);
-							this->_rightRotate(sibling);
+							this->_leftRotate(sibling);
 							sibling = fixParent->_left;
 						}
 						// Case 4: Black sibling with red right child
@@ -1019,8 +1087,9 @@ namespace MSTD {
 				_NodePtr nPos = ret;
 
 				if (nPos == pos->_right) {
-					fix = nPos;
-					fixParent = pos->_parent;
+					// nPos keeps its right subtree
+					fix = nPos->_right;
+					fixParent = nPos;
 				}
 				else {
 					fix = nPos->_right;
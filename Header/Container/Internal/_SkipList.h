@@ -40,7 +40,12 @@ namespace MSTD {
 		template<typename NodeAlloc>
 		static _NodePtr createNode(NodeAlloc &alloc, size_t level)
 		{
-			_NodePtr node = AllocatorTraits<NodeAlloc>::allocate(alloc, 1);
+			return initNode(AllocatorTraits<NodeAlloc>::allocate(alloc, 1), level);
+		}
+
+		// Initialize links of an allocated node
+		static _NodePtr initNode(_NodePtr node, size_t level)
+		{
 			node->_up = node->_down = nullptr;
 			node->_forward = node->_next = nullptr;
 			node->_ptr = nullptr;
@@ -252,12 +257,21 @@ namespace MSTD {
 		using ConstReverseIterator = MSTD::ReverseIterator<ConstIterator>;
 		using ReverseIterator = MSTD::ReverseIterator<Iterator>;
 
-		using AllocatorType = typename _Config::AllocatorType;
-		using _NodeAlloc = MSTD::Allocator<_SkipNode<ValueType>>;
-
 		using _Node = _SkipNode<ValueType>;
 		using _NodePtr = _SkipNode<ValueType>*;
 
+		using AllocatorType = typename _Config::AllocatorType;
+		using _NodeAlloc = typename AllocatorTraits<AllocatorType>::template rebind<_Node>;
+		using _LevelAlloc = typename AllocatorTraits<AllocatorType>::template rebind<_NodePtr>;
+		// Nodes and elements needn't be visited one by one
+		// on clean up
+		using _BulkRelease = typename conditional<
+			isTriviallyDestructible<ValueType>::value &&
+			AllocatorTraits<AllocatorType>::IsBulkReleased::value &&
+			AllocatorTraits<_NodeAlloc>::IsBulkReleased::value,
+			trueType, falseType
+		>::type;
+
 		using _PairIB = std::pair<Iterator, bool>;
 		using _PairCB = std::pair<ConstIterator, bool>;
 		using _RangePtr = std::pair<_NodePtr, _NodePtr>;
@@ -271,22 +285,17 @@ namespace MSTD {
 		////////////////////////////////////
 
 		_SkipList() :
-			_levels(),
-			_size(0),
-			_comp(),
-			_dataAl(),
-			_nodeAl()
-		{
-			_initialize();
-		}
+			_SkipList(KeyCompare(), AllocatorType())
+		{}
 
 		explicit _SkipList(const KeyCompare &comp, 
 			const AllocatorType &alloc = AllocatorType()) :
-			_levels(),
+			_levels(_LevelAlloc(alloc)),
 			_size(0),
+			_nil(nullptr),
 			_comp(comp),
 			_dataAl(alloc),
-			_nodeAl()
+			_nodeAl(alloc)
 		{
 			_initialize();
 		}
@@ -301,13 +310,11 @@ namespace MSTD {
 					const AllocatorType &alloc = AllocatorType()) :
 			_SkipList(comp, alloc)
 		{
-			while (first != last) {
-				_auxInsert(*first++);
-			}
+			_insertRange(first, last);
 		}
 
 		_SkipList(const _SkipList &that) :
-			_SkipList(that.begin(), that.end())
+			_SkipList(that.begin(), that.end(), that._comp, that._dataAl)
 		{}
 
 		_SkipList(_SkipList &&that) noexcept :
@@ -322,6 +329,19 @@ namespace MSTD {
 			that._size = 0;
 		}
 
+		// Steal the nodes of {that} only if they are
+		// released by {alloc}, otherwise copy elements
+		_SkipList(_SkipList &&that, const AllocatorType &alloc) :
+			_SkipList(that._comp, alloc)
+		{
+			if (_dataAl == that._dataAl) {
+				_swapList(that);
+			}
+			else {
+				_assignList(that);
+			}
+		}
+
 		_SkipList(std::initializer_list<ValueType> il,
 					const KeyCompare &comp = KeyCompare(),
 					const AllocatorType &alloc = AllocatorType()) :
@@ -336,33 +356,30 @@ namespace MSTD {
 		_SkipList& operator=(const _SkipList &that)
 		{
 			if (this != MSTD::addressof(that)) {
-				_cleanUp();
-
+				// Allocators are kept
 				_comp = that._comp;
-				_dataAl = that._dataAl;
-				_nodeAl = that._nodeAl;
-
-				_initialize();
-				for (auto &&val : that) {
-					_NodePtr node = _Node::createNode(_nodeAl, 0);
-					_Node::constructNode(_dataAl, node, val);
-					_auxInsert(node);
-				}
+				_assignList(that);
 			}
 			return *this;
 		}
 
-		_SkipList& operator=(_SkipList &&that) noexcept
+		// Allocators are kept, nodes of {that} are stolen
+		// only if both allocators are equal
+		_SkipList& operator=(_SkipList &&that)
 		{
 			if (this != MSTD::addressof(that)) {
-				_levels = MSTD::move(that._levels);
-				_nil = MSTD::move(that._nil);
-				_size = MSTD::move(that._size);
 				_comp = MSTD::move(that._comp);
-				_dataAl = MSTD::move(that._dataAl);
-				_nodeAl = MSTD::move(that._nodeAl);
-				that._nil = nullptr;
-				that._size = 0;
+				if (_dataAl == that._dataAl) {
+					_destroy();
+					_levels = MSTD::move(that._levels);
+					_nil = that._nil;
+					_size = that._size;
+					that._nil = nullptr;
+					that._size = 0;
+				}
+				else {
+					_assignList(that);
+				}
 			}
 			return *this;
 		}
@@ -469,7 +486,7 @@ namespace MSTD {
 		void clear() noexcept
 		{
 			_cleanUp();
-			_initialize();
+			_requireLevel(0);
 		}
 
 		Iterator erase(ConstIterator pos)
@@ -506,9 +523,7 @@ namespace MSTD {
 		template<typename InputIt>
 		void insert(InputIt first, InputIt last)
 		{
-			while (first != last) {
-				insert(*first++);
-			}
+			_insertRange(first, last);
 		}
 
 		void insert(std::initializer_list<ValueType> il)
@@ -580,6 +595,11 @@ namespace MSTD {
 			swap(_nodeAl, that._nodeAl);
 		}
 
+		AllocatorType getAllocator() const
+		{
+			return _dataAl;
+		}
+
 		/////////////////////////////////////
 		//
 		//			Lookup
@@ -646,12 +666,48 @@ namespace MSTD {
 
 		void _destroy() noexcept
 		{
-			_cleanUp();
-			_Node::deallocateNode(_nodeAl, _nil);
+			if (_nil) {
+				_cleanUp();
+				_Node::deallocateNode(_nodeAl, _nil);
+				_nil = nullptr;
+			}
 		}
 
-		void _cleanUp() noexcept
+		// Exchange nodes with {that}, allocators are
+		// left unchanged
+		void _swapList(_SkipList &that) noexcept
 		{
+			using std::swap;
+			_levels.swap(that._levels);
+			swap(_nil, that._nil);
+			swap(_size, that._size);
+		}
+
+		// Replace elements with copies of {that}
+		void _assignList(const _SkipList &that)
+		{
+			if (_nil) {
+				clear();
+			}
+			else {
+				_initialize();
+			}
+			for (auto &&val : that) {
+				_NodePtr node = _Node::createNode(_nodeAl, 0);
+				_Node::constructNode(_dataAl, node, val);
+				_auxInsert(node);
+			}
+		}
+
+		void _auxCleanUp(trueType) noexcept
+		{
+			// no-op, nodes are released with the allocator
+		}
+
+		void _auxCleanUp(falseType) noexcept
+		{
+			// Nodes of all levels are deallocated in one batch
+			_NodeBatch<_NodeAlloc> spare(_nodeAl);
 			for (auto header : _levels) {
 				_NodePtr cur = header->_next;
 				while (!_isEnd(cur)) {
@@ -659,11 +715,16 @@ namespace MSTD {
 					if (cur->_level == 0) {
 						_Node::destroyNode(_dataAl, cur);
 					}
-					_Node::deallocateNode(_nodeAl, cur);
+					spare.give(cur);
 					cur = next;
 				}
-				_Node::deallocateNode(_nodeAl, header);
+				spare.give(header);
 			}
+		}
+
+		void _cleanUp() noexcept
+		{
+			_auxCleanUp(_BulkRelease());
 			_size = 0;
 			_levels.clear();
 		}
@@ -801,7 +862,32 @@ namespace MSTD {
 			pos->_next = node;
 		}
 
-		_PairIB _auxInsert(const ValueType &val)
+		// Take a bottom level node from {spare} if any,
+		// or allocate a new one
+		_NodePtr _newNode(_NodeBatch<_NodeAlloc> *spare)
+		{
+			if (spare) {
+				return _Node::initNode(spare->take(), 0);
+			}
+			return _Node::createNode(_nodeAl, 0);
+		}
+
+		// Insert elements of [first, last), bottom level 
+		// nodes of a range with known length are allocated
+		// in one batch
+		template<typename InputIt>
+		void _insertRange(InputIt first, InputIt last)
+		{
+			_NodeBatch<_NodeAlloc> spare(_nodeAl);
+			spare.reserve(first, last);
+			for (; first != last; ++first) {
+				_auxInsert(*first, &spare);
+			}
+		}
+
+		// Insert {val}, bottom level node is taken from 
+		// {spare} if given
+		_PairIB _auxInsert(const ValueType &val, _NodeBatch<_NodeAlloc> *spare = nullptr)
 		{
 			// Find insertion position
 			_NodePtr pos = _search(_getKeyFromVal(val));
@@ -811,7 +897,7 @@ namespace MSTD {
 				_requireLevel(0);
 				pos = _levels.front();
 				// Insert
-				_NodePtr node = _Node::createNode(_nodeAl, 0);
+				_NodePtr node = _newNode(spare);
 				_Node::constructNode(_dataAl, node, (val));
 				_insertNodeAt(pos, node);
 				// Level up
@@ -822,7 +908,7 @@ namespace MSTD {
 			
 			if (this->_MULTI) {
 				// Insert
-				_NodePtr node = _Node::createNode(_nodeAl, 0);
+				_NodePtr node = _newNode(spare);
 				_Node::constructNode(_dataAl, node, (val));
 				_insertNodeAt(pos, node);
 				// Level up
@@ -838,7 +924,7 @@ namespace MSTD {
 						_getKeyFromVal(val)
 				)) { // Unique element
 					// Insert
-					_NodePtr node = _Node::createNode(_nodeAl, 0);
+					_NodePtr node = _newNode(spare);
 					_Node::constructNode(_dataAl, node, (val));
 					_insertNodeAt(pos, node);
 					// Level up
@@ -853,7 +939,7 @@ namespace MSTD {
 			}
 		}
 
-		_PairIB _auxInsert(ValueType &&val)
+		_PairIB _auxInsert(ValueType &&val, _NodeBatch<_NodeAlloc> *spare = nullptr)
 		{
 			// Find insertion position
 			_NodePtr pos = _search(_getKeyFromVal(val));
@@ -863,7 +949,7 @@ namespace MSTD {
 				_requireLevel(0);
 				pos = _levels.front();
 				// Insert
-				_NodePtr node = _Node::createNode(_nodeAl, 0);
+				_NodePtr node = _newNode(spare);
 				_Node::constructNode(_dataAl, node, MSTD::move(val));
 				_insertNodeAt(pos, node);
 				// Level up
@@ -874,7 +960,7 @@ namespace MSTD {
 
 			if (this->_MULTI) {
 				// Insert
-				_NodePtr node = _Node::createNode(_nodeAl, 0);
+				_NodePtr node = _newNode(spare);
 				_Node::constructNode(_dataAl, node, MSTD::move(val));
 				_insertNodeAt(pos, node);
 				// Level up
@@ -890,7 +976,7 @@ namespace MSTD {
 						_getKeyFromVal(val)
 					)) { // Unique element
 						// Insert
-					_NodePtr node = _Node::createNode(_nodeAl, 0);
+					_NodePtr node = _newNode(spare);
 					_Node::constructNode(_dataAl, node, MSTD::move(val));
 					_insertNodeAt(pos, node);
 					// Level up
@@ -979,7 +1065,7 @@ namespace MSTD {
 		}
 
 	protected:
-		Vector<_NodePtr> _levels; // Store all header pointers of each level
+		Vector<_NodePtr, _LevelAlloc> _levels; // Store all header pointers of each level
 		SizeType _size; // Number of elements in skip list
 		_NodePtr _nil; // Dummy node for nil
 		KeyCompare _comp;
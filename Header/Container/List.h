@@ -37,7 +37,7 @@ namespace MSTD {
 		_ListNode(T &&val) :
 			_pre(nullptr),
 			_next(nullptr),
-			_val(move(val))
+			_val(MSTD::move(val))
 		{}
 
 		_ListNode(_NodePtr pre, _NodePtr next) :
@@ -54,7 +54,7 @@ namespace MSTD {
 		_ListNode(_NodePtr pre, _NodePtr next, T &&val) :
 			_pre(pre),
 			_next(next),
-			_val(move(val))
+			_val(MSTD::move(val))
 		{}
 
 		_NodePtr _next; // Successor node
@@ -93,7 +93,7 @@ namespace MSTD {
 		// Return Pointer to element object
 		Pointer operator->() const
 		{
-			return addressof(this->operator*());
+			return MSTD::addressof(this->operator*());
 		}
 
 		_ListConstIterator& operator++()
@@ -168,7 +168,7 @@ namespace MSTD {
 		// Return Pointer to element object
 		Pointer operator->() const
 		{
-			return addressof(this->operator*());
+			return MSTD::addressof(this->operator*());
 		}
 
 		_ListIterator& operator++()
@@ -221,8 +221,13 @@ namespace MSTD {
 		using ReverseIterator = ReverseIterator<Iterator>;
 
 		using _NodePtr = typename _ListNode<ValueType>::_NodePtr;
-		//using _NodeAlloc = typename MSTD::AllocatorTraits<Alloc>::rebind<_NodePtr>;
-		using _NodeAlloc = MSTD::Allocator<_ListNode<ValueType>>;
+		using _NodeAlloc = typename AllocatorTraits<Alloc>::template rebind<_ListNode<ValueType>>;
+		// Nodes needn't be visited one by one on clean up
+		using _BulkRelease = typename conditional<
+			isTriviallyDestructible<ValueType>::value &&
+			AllocatorTraits<_NodeAlloc>::IsBulkReleased::value,
+			trueType, falseType
+		>::type;
 
 		static_assert(isSame<ValueType, typename AllocatorTraits<Alloc>::ValueType>::value,
 			"Allocator require the same type T with List<T>");
@@ -234,18 +239,13 @@ namespace MSTD {
 		/////////////////////////////////////		
 
 		List() :
-			_pHead(nullptr),
-			_alloc(),
-			_nodeAlloc(),
-			_size(0)
-		{
-			_initialize();
-		}
+			List(Alloc())
+		{}
 
 		explicit List(const Alloc &alloc) :
 			_pHead(nullptr),
 			_alloc(alloc),
-			_nodeAlloc(),
+			_nodeAlloc(alloc),
 			_size(0)
 		{
 			_initialize();
@@ -263,7 +263,7 @@ namespace MSTD {
 			List(alloc)
 		{			
 			for (; 0 < count; --count) {
-				_auxInsert(begin()._ptr, ValueType());
+				emplace(cbegin());
 			}
 		}
 
@@ -280,7 +280,7 @@ namespace MSTD {
 		}
 
 		List(const List &that) :
-			List()
+			List(that._alloc)
 		{			
 			_auxInsertRange(end()._ptr, that.begin(), that.end());
 		}
@@ -292,23 +292,28 @@ namespace MSTD {
 		}
 
 		List(List &&that) noexcept:
-			_pHead(move(that._pHead)),
-			_alloc(move(that._alloc)),
-			_nodeAlloc(move(that._nodeAlloc)),
-			_size(move(that._size))
+			_pHead(MSTD::move(that._pHead)),
+			_alloc(MSTD::move(that._alloc)),
+			_nodeAlloc(MSTD::move(that._nodeAlloc)),
+			_size(MSTD::move(that._size))
 		{
 			that._pHead = nullptr;
 			that._size = 0;
 		}
 
+		// Steal the nodes of {that} only if they are
+		// released by {alloc}, otherwise move elements
 		List(List &&that, const Alloc &alloc) :
-			_pHead(move(that._pHead)),
-			_alloc(alloc),
-			_nodeAlloc(move(that._nodeAlloc)),
-			_size(move(that._size))
+			List(alloc)
 		{
-			that._pHead = nullptr;
-			that._size = 0;
+			if (_alloc == that._alloc) {
+				using std::swap;
+				swap(_pHead, that._pHead);
+				swap(_size, that._size);
+			}
+			else {
+				_moveFrom(that);
+			}
 		}
 
 		List(std::initializer_list<ValueType> li, const Alloc &alloc = Alloc()) :
@@ -331,15 +336,20 @@ namespace MSTD {
 			return *this;
 		}
 
-		List& operator=(List &&that) noexcept
+		// Allocator is kept, nodes of {that} are stolen
+		// only if both allocators are equal
+		List& operator=(List &&that)
 		{
 			if (this != MSTD::addressof(that)) {
-				_size = that._size;
-				that._size = 0;
-				_pHead = that._pHead;
-				that._pHead = nullptr;
-				_alloc = that._alloc;
-				_nodeAlloc = that._nodeAlloc;
+				if (_alloc == that._alloc) {
+					using std::swap;
+					swap(_pHead, that._pHead);
+					swap(_size, that._size);
+				}
+				else {
+					clear();
+					_moveFrom(that);
+				}
 			}
 
 			return *this;
@@ -517,7 +527,7 @@ namespace MSTD {
 
 		Iterator insert(ConstIterator pos, ValueType &&val)
 		{
-			return Iterator(_auxInsert(pos._ptr, move(val)));
+			return Iterator(_auxInsert(pos._ptr, MSTD::move(val)));
 		}
 
 		Iterator insert(ConstIterator pos, SizeType count, const ValueType &val)
@@ -548,7 +558,7 @@ namespace MSTD {
 		Iterator emplace(ConstIterator pos, Args&&... args)
 		{
 			auto pNode = _allocateNode();
-			_constructNode(pNode, forward<Args>(args)...);
+			_constructNode(pNode, MSTD::forward<Args>(args)...);
 
 			// Insert the node
 			pNode->_pre = pos._ptr->_pre;
@@ -577,13 +587,13 @@ namespace MSTD {
 
 		void pushBack(ValueType &&val)
 		{
-			_auxInsert(end()._ptr, move(val));
+			_auxInsert(end()._ptr, MSTD::move(val));
 		}
 
 		template<typename... Args>
 		Reference emplaceBack(Args&&... args)
 		{
-			auto node = emplace(cend(), forward<Args>(args)...);
+			auto node = emplace(cend(), MSTD::forward<Args>(args)...);
 			return node._ptr->_val;
 		}
 
@@ -599,13 +609,13 @@ namespace MSTD {
 
 		void pushFront(ValueType &&val)
 		{
-			_auxInsert(begin()._ptr, move(val));
+			_auxInsert(begin()._ptr, MSTD::move(val));
 		}
 
 		template<typename... Args>
 		Reference emplaceFront(Args&&... args)
 		{
-			auto node = emplace(cbegin(), forward<Args>(args)...);
+			auto node = emplace(cbegin(), MSTD::forward<Args>(args)...);
 			return node._ptr->_val;
 		}
 
@@ -614,9 +624,16 @@ namespace MSTD {
 			_auxErase(begin()._ptr);
 		}
 
+		// New elements are constructed by the allocator
+		// with no argument
 		void resize(SizeType count)
 		{
-			_auxResize(count);
+			while (size() > count) {
+				popBack();
+			}
+			while (size() < count) {
+				emplaceBack();
+			}
 		}
 
 		void resize(SizeType count, const ValueType &val)
@@ -647,7 +664,7 @@ namespace MSTD {
 		template<typename Comp>
 		void merge(List &that, Comp comp)
 		{
-			if (this != addressof(that)) {
+			if (this != MSTD::addressof(that)) {
 				auto iBeg = begin();
 				auto jBeg = that.begin();
 				while (jBeg != that.end() && iBeg != end()) {
@@ -669,7 +686,7 @@ namespace MSTD {
 
 		void splice(ConstIterator pos, List &that)
 		{
-			if (this != addressof(that)) {
+			if (this != MSTD::addressof(that)) {
 				_auxSplice(pos._ptr, that.begin()._ptr, that.end()._ptr);
 				_size += that._size;
 				that._size = 0;
@@ -678,7 +695,7 @@ namespace MSTD {
 
 		void splice(ConstIterator pos, List &that, ConstIterator it)
 		{
-			if ((this != addressof(that))) {
+			if ((this != MSTD::addressof(that))) {
 				_auxSplice(pos._ptr, it._ptr, it._ptr->_next);
 				_size += 1;
 				that._size -= 1;
@@ -690,7 +707,7 @@ namespace MSTD {
 
 		void splice(ConstIterator pos, List &that, ConstIterator first, ConstIterator last)
 		{
-			if (this != addressof(that)) {
+			if (this != MSTD::addressof(that)) {
 				auto dis = distance(first, last);
 				_size += dis;
 				that._size -= dis;
@@ -806,15 +823,15 @@ namespace MSTD {
 		{			
 			AllocatorTraits<Alloc>::construct(
 				_alloc, 
-				addressof(pNode->_val),
-				forward<Args>(args)...
+				MSTD::addressof(pNode->_val),
+				MSTD::forward<Args>(args)...
 			);
 		}
 
 		// Destruct element value
 		void _destroyNode(_NodePtr pNode)
 		{			
-			AllocatorTraits<Alloc>::destroy(_alloc, addressof(pNode->_val));
+			AllocatorTraits<Alloc>::destroy(_alloc, MSTD::addressof(pNode->_val));
 		}
 
 		// Give back node space
@@ -826,25 +843,47 @@ namespace MSTD {
 		// Destroy the list
 		void _destroy()
 		{
-			_cleanUp();
-			// Free head nodes
-			_deallocateNode(_pHead);
+			if (_pHead) {
+				_cleanUp();
+				// Free head nodes
+				_deallocateNode(_pHead);
+			}
 		}
 
-		// Set List to the initialized state
-		void _cleanUp()
+		// Move elements of {that} to the back of {this}
+		void _moveFrom(List &that)
+		{
+			for (auto &val : that) {
+				emplaceBack(MSTD::move(val));
+			}
+		}
+
+		void _auxCleanUp(trueType)
+		{
+			// no-op, nodes are released with the allocator
+		}
+
+		void _auxCleanUp(falseType)
 		{
 			auto first = begin();
 			auto last = end();
 			auto next = first;
 
-			// Free all elements and nodes
+			// Free all elements, nodes are 
+			// deallocated in one batch
+			_NodeBatch<_NodeAlloc> spare(_nodeAlloc);
 			while (next != last) {
 				++next;
 				_destroyNode(first._ptr);
-				_deallocateNode(first._ptr);
+				spare.give(first._ptr);
 				first = next;
 			}
+		}
+
+		// Set List to the initialized state
+		void _cleanUp()
+		{
+			_auxCleanUp(_BulkRelease());
 
 			// Reset head node
 			_pHead->_pre = _pHead->_next = _pHead;
@@ -859,24 +898,21 @@ namespace MSTD {
 			_NodePtr tmp = _allocateNode();
 			_constructNode(tmp, val);
 
-			// Insert the new node
-			tmp->_next = pos;
-			tmp->_pre = pos->_pre;
-			pos->_pre->_next = tmp;
-			pos->_pre = tmp;
-
-			// increase the size counter
-			++_size;
-
-			return tmp;
+			return _linkNode(pos, tmp);
 		}
 
 		_NodePtr _auxInsert(_NodePtr pos, ValueType &&val)
 		{
 			// Construct the node to be inserted
 			_NodePtr tmp = _allocateNode();
-			_constructNode(tmp, move(val));
+			_constructNode(tmp, MSTD::move(val));
 
+			return _linkNode(pos, tmp);
+		}
+
+		// Link constructed node {tmp} before {pos}
+		_NodePtr _linkNode(_NodePtr pos, _NodePtr tmp)
+		{
 			// Insert the new node
 			tmp->_next = pos;
 			tmp->_pre = pos->_pre;
@@ -894,8 +930,19 @@ namespace MSTD {
 		_NodePtr _auxInsertRange(_NodePtr pos, InputIt first, InputIt last)
 		{
 			auto pre = pos->_pre;
+			// Nodes of a range with known length are
+			// allocated in one batch
+			_NodeBatch<_NodeAlloc> spare(_nodeAlloc);
+			spare.reserve(first, last);
 			for (; first != last; ++first) {
-				_auxInsert(pos, *first);
+				_NodePtr tmp = spare.take();
+				_MSTD_TRY
+					_constructNode(tmp, *first);
+				_MSTD_CATCH_ALL
+					spare.give(tmp);
+					throw;
+				_MSTD_END_CATCH
+				_linkNode(pos, tmp);
 			}
 
 			return pre->_next;
@@ -928,7 +975,7 @@ namespace MSTD {
 			return last;
 		}
 
-		void _auxResize(SizeType count, const ValueType &val = ValueType())
+		void _auxResize(SizeType count, const ValueType &val)
 		{
 			if (count < size()) {
 				// Shrink List
@@ -1070,7 +1117,7 @@ namespace MSTD {
 	}
 
 	template<typename T, typename Alloc>
-	void swap(List<T, alloc> &lhs, List<T, Alloc> &rhs) noexcept
+	void swap(List<T, Alloc> &lhs, List<T, Alloc> &rhs) noexcept
 	{
 		lhs.swap(rhs);
 	}
@@ -89,6 +89,10 @@ namespace MSTD {
 			_Base()
 		{}
 
+		explicit Map(const AllocatorType &alloc) :
+			_Base(alloc)
+		{}
+
 		explicit Map(const KeyCompare &comp,
 			const AllocatorType &alloc = AllocatorType()) :
 			_Base(comp, alloc)
@@ -121,7 +125,7 @@ namespace MSTD {
 			return *this;
 		}
 
-		Map& operator=(Map &&that) noexcept
+		Map& operator=(Map &&that)
 		{
 			_Base::operator=(MSTD::move(that));
 			return *this;
@@ -298,6 +302,10 @@ namespace MSTD {
 			_Base()
 		{}
 
+		explicit MultiMap(const AllocatorType &alloc) :
+			_Base(alloc)
+		{}
+
 		explicit MultiMap(const KeyCompare &comp,
 			const AllocatorType &alloc = AllocatorType()) :
 			_Base(comp, alloc)
@@ -330,7 +338,7 @@ namespace MSTD {
 			return *this;
 		}
 
-		MultiMap& operator=(MultiMap &&that) noexcept
+		MultiMap& operator=(MultiMap &&that)
 		{
 			_Base::operator=(MSTD::move(that));
 			return *this;
@@ -6,6 +6,7 @@
 //#include <Config/Config.h>
 #include <Alloc/Allocator.h>
 #include <Iterator/Iterator.h>
+#include <Container/Internal/_Adaptor.h>
 #include <Container/Vector.h>
 
 // STL header and cpp standard header
@@ -132,20 +133,20 @@ namespace MSTD {
 
 		void push(const ValueType &val)
 		{
-			_heap.pushBack(val);
+			_adaptorEmplaceBack(_heap, val);
 			_precolateUp(_heap.size() - 1);
 		}
 
 		void push(ValueType &&val)
 		{
-			_heap.pushBack(move(val));
+			_adaptorEmplaceBack(_heap, move(val));
 			_precolateUp(_heap.size() - 1);
 		}
 
 		template< class... Args >
 		void emplace(Args&&... args)
 		{
-			_heap.emplace(forward<Args>(args)...);
+			_adaptorEmplaceBack(_heap, MSTD::forward<Args>(args)...);
 			_precolateUp(_heap.size() - 1);
 		}
 
@@ -157,8 +158,9 @@ namespace MSTD {
 		}
 
 		void swap(PriorityQueue &that) noexcept
-		{		
-			swap(_heap, that._heap);
+		{
+			_heap.swap(that._heap);
+			using std::swap;
 			swap(_comp, that._comp);
 		}
 
@@ -84,6 +84,10 @@ namespace MSTD {
 			_Base()
 		{}
 
+		explicit Set(const AllocatorType &alloc) :
+			_Base(alloc)
+		{}
+
 		explicit Set(const KeyCompare &comp,
 			const AllocatorType &alloc = AllocatorType()) :
 			_Base(comp, alloc)
@@ -116,7 +120,7 @@ namespace MSTD {
 			return *this;
 		}
 
-		Set& operator=(Set &&that) noexcept
+		Set& operator=(Set &&that)
 		{
 			_Base::operator=(MSTD::move(that));
 			return *this;
@@ -251,6 +255,10 @@ namespace MSTD {
 			_Base()
 		{}
 
+		explicit MultiSet(const AllocatorType &alloc) :
+			_Base(alloc)
+		{}
+
 		explicit MultiSet(const KeyCompare &comp,
 			const AllocatorType &alloc = AllocatorType()) :
 			_Base(comp, alloc)
@@ -283,7 +291,7 @@ namespace MSTD {
 			return *this;
 		}
 
-		MultiSet& operator=(MultiSet &&that) noexcept
+		MultiSet& operator=(MultiSet &&that)
 		{
 			_Base::operator=(MSTD::move(that));
 			return *this;
@@ -0,0 +1,338 @@
+#pragma once
+
+// SmallVector header
+
+// Mini-STL header
+#include <Config/Config.h>
+#include <Alloc/Allocator.h>
+#include <TypeInfo/TypeTraits.h>
+#include <Iterator/Iterator.h>
+#include <Container/Vector.h>
+
+// STL header and cpp standard header
+#include <initializer_list>
+
+namespace MSTD {
+
+	// Allocator of SmallVector.
+	// The inline buffer of its owner is handed out as a
+	// whole while it is free and large enough, other
+	// requests go to {Alloc}
+	template<typename Alloc, size_t N>
+	class _SmallVecAlloc : public Alloc
+	{
+	public:
+		using ValueType = typename AllocatorTraits<Alloc>::ValueType;
+		using Pointer = typename AllocatorTraits<Alloc>::Pointer;
+		using SizeType = typename AllocatorTraits<Alloc>::SizeType;
+
+		_SmallVecAlloc(Pointer buffer, const Alloc &alloc) noexcept :
+			Alloc(alloc),
+			_buffer(buffer),
+			_inUse(false)
+		{}
+
+		AllocResult<Pointer, SizeType> allocateAtLeast(SizeType n)
+		{
+			if (n <= N && !_inUse) {
+				_inUse = true;
+				return { _buffer, N };
+			}
+			return AllocatorTraits<Alloc>::allocateAtLeast(*this, n);
+		}
+
+		Pointer allocate(SizeType n)
+		{
+			return allocateAtLeast(n).ptr;
+		}
+
+		void deallocate(Pointer p, SizeType n)
+		{
+			if (p == _buffer) {
+				_inUse = false;
+			}
+			else {
+				Alloc::deallocate(p, n);
+			}
+		}
+
+		bool tryExpandInPlace(Pointer p, SizeType n, SizeType newCount)
+		{
+			if (p == _buffer) {
+				return newCount <= N;
+			}
+			return AllocatorTraits<Alloc>::tryExpandInPlace(*this, p, n, newCount);
+		}
+
+		// Elements leaving the inline buffer are copied,
+		// others are resized by {Alloc}
+		AllocResult<Pointer, SizeType> reallocate(Pointer p, SizeType n, SizeType newCount)
+		{
+			if (p != _buffer) {
+				return AllocatorTraits<Alloc>::reallocate(*this, p, n, newCount);
+			}
+			if (newCount <= N) {
+				return { _buffer, N };
+			}
+
+			auto ret = AllocatorTraits<Alloc>::allocateAtLeast(*this, newCount);
+			std::memcpy(static_cast<void*>(ret.ptr), static_cast<const void*>(_buffer), n * sizeof(ValueType));
+			_inUse = false;
+			return ret;
+		}
+
+		Pointer buffer() const noexcept
+		{
+			return _buffer;
+		}
+
+		const Alloc& inner() const noexcept
+		{
+			return *this;
+		}
+
+	private:
+		Pointer _buffer;
+		bool _inUse;
+	};
+
+	// Allocators of different SmallVectors never share
+	// their buffers
+	template<typename Alloc, size_t N>
+	inline
+	bool operator==(const _SmallVecAlloc<Alloc, N> &lhs, const _SmallVecAlloc<Alloc, N> &rhs) noexcept
+	{
+		return lhs.buffer() == rhs.buffer() && lhs.inner() == rhs.inner();
+	}
+
+	template<typename Alloc, size_t N>
+	inline
+	bool operator!=(const _SmallVecAlloc<Alloc, N> &lhs, const _SmallVecAlloc<Alloc, N> &rhs) noexcept
+	{
+		return !(lhs == rhs);
+	}
+
+	// Inline storage of SmallVector, as its first base it
+	// is alive before and after elements are put in it
+	template<typename T, size_t N>
+	struct _SmallVecBuffer
+	{
+		T* _bufferData() noexcept
+		{
+			return static_cast<T*>(static_cast<void*>(_bytes));
+		}
+
+		alignas(T) unsigned char _bytes[N * sizeof(T)];
+	};
+
+	// SmallVector<T, N>
+	// Vector keeping up to N elements inside itself, so
+	// small ones never allocate. It spills to {Alloc} when
+	// elements don't fit, and goes back to the inline
+	// buffer by shrinkToFit() once they fit again.
+	// Inline elements are moved one by one when the vector
+	// is moved or swapped
+	template<
+		typename T, // Element type
+		size_t N, // Count of inline elements
+		typename Alloc = Allocator<T> // Allocator after spilled
+	> class SmallVector :
+		private _SmallVecBuffer<T, N>,
+		public Vector<T, _SmallVecAlloc<Alloc, N>>
+	{
+		static_assert(N > 0, "SmallVector needs room for one element at least");
+
+		using _Alloc = _SmallVecAlloc<Alloc, N>;
+		using _Base = Vector<T, _Alloc>;
+
+	public:
+		using AllocatorType = Alloc;
+		using SizeType = typename _Base::SizeType;
+		using ValueType = typename _Base::ValueType;
+		using Pointer = typename _Base::Pointer;
+
+		/////////////////////////////////////
+		//
+		//	Constructors and destructor
+		//
+		/////////////////////////////////////
+
+		SmallVector() noexcept(noexcept(Alloc())) :
+			SmallVector(Alloc())
+		{}
+
+		explicit SmallVector(const Alloc &alloc) noexcept :
+			_Base(_Alloc(this->_bufferData(), alloc))
+		{
+			_useBuffer();
+		}
+
+		SmallVector(SizeType count, const ValueType &val, const Alloc &alloc = Alloc()) :
+			SmallVector(alloc)
+		{
+			this->insert(this->end(), count, val);
+		}
+
+		template<
+			typename InputIt,
+			typename = typename enableIf<
+								!isSame<typename IteratorTraits<InputIt>::IteratorCategory, void>::value,
+								void
+			>::type>
+		SmallVector(InputIt first, InputIt last, const Alloc &alloc = Alloc()) :
+			SmallVector(alloc)
+		{
+			this->insert(this->end(), first, last);
+		}
+
+		SmallVector(std::initializer_list<ValueType> li, const Alloc &alloc = Alloc()) :
+			SmallVector(alloc)
+		{
+			this->insert(this->end(), li.begin(), li.end());
+		}
+
+		SmallVector(const SmallVector &that) :
+			SmallVector(that, that.getAllocator())
+		{}
+
+		SmallVector(const SmallVector &that, const Alloc &alloc) :
+			SmallVector(alloc)
+		{
+			this->insert(this->end(), that.begin(), that.end());
+		}
+
+		// Spilled storage of {that} is stolen, inline
+		// elements are moved. {that} is left empty
+		SmallVector(SmallVector &&that) noexcept(isNothrowMoveConstructible<ValueType>::value) :
+			SmallVector(that.getAllocator())
+		{
+			_moveFrom(that);
+		}
+
+		SmallVector(SmallVector &&that, const Alloc &alloc) :
+			SmallVector(alloc)
+		{
+			_moveFrom(that);
+		}
+
+		AllocatorType getAllocator() const
+		{
+			return this->_alloc.inner();
+		}
+
+		SmallVector& operator=(const SmallVector &that)
+		{
+			if (this != &that) {
+				this->erase(this->begin(), this->end());
+				this->insert(this->end(), that.begin(), that.end());
+			}
+
+			return *this;
+		}
+
+		// Allocator is kept, spilled storage of {that} is
+		// stolen only if both allocators are equal
+		SmallVector& operator=(SmallVector &&that)
+		{
+			if (this != &that) {
+				_moveFrom(that);
+			}
+
+			return *this;
+		}
+
+		SmallVector& operator=(std::initializer_list<ValueType> li)
+		{
+			this->assign(li.begin(), li.end());
+
+			return *this;
+		}
+
+		/////////////////////////////////////
+		//
+		//			 Capacity
+		//
+		/////////////////////////////////////
+
+		// Elements don't live in memory of the allocator
+		bool isInline() const noexcept
+		{
+			return !_isSpilled();
+		}
+
+		// Spilled elements go back to the inline buffer
+		// if they fit, the inline buffer is never shrunk
+		void shrinkToFit()
+		{
+			if (_isSpilled()) {
+				_Base::shrinkToFit();
+			}
+		}
+
+		/////////////////////////////////////
+		//
+		//			 Modifiers
+		//
+		/////////////////////////////////////
+
+		void swap(SmallVector &that)
+		{
+			if (_isSpilled() && that._isSpilled() &&
+				this->_alloc.inner() == that._alloc.inner()) {
+				this->_vBase.swap(that._vBase);
+			}
+			else {
+				SmallVector tmp(MSTD::move(*this));
+				*this = MSTD::move(that);
+				that = MSTD::move(tmp);
+			}
+		}
+
+	private:
+		bool _isSpilled() const noexcept
+		{
+			return this->_vBase._beg != nullptr &&
+				this->_vBase._beg != this->_alloc.buffer();
+		}
+
+		// Put elements in the inline buffer, which must
+		// be free, and the vector has no storage
+		void _useBuffer() noexcept
+		{
+			auto result = this->_alloc.allocateAtLeast(N);
+			this->_vBase = _VecBase<Pointer>(result.ptr, result.ptr, result.ptr + result.count);
+		}
+
+		// Give back storage with all elements destroyed
+		void _release()
+		{
+			this->erase(this->begin(), this->end());
+			if (this->_vBase._beg) {
+				this->_alloc.deallocate(this->_vBase._beg, this->capacity());
+			}
+			this->_vBase = _VecBase<Pointer>();
+		}
+
+		void _moveFrom(SmallVector &that)
+		{
+			if (that._isSpilled() && this->_alloc.inner() == that._alloc.inner()) {
+				_release();
+				this->_vBase = MSTD::move(that._vBase);
+				that._useBuffer();
+			}
+			else {
+				this->erase(this->begin(), this->end());
+				this->insert(this->end(),
+							 makeMoveIterator(that.begin()),
+							 makeMoveIterator(that.end()));
+				that.erase(that.begin(), that.end());
+			}
+		}
+	};
+
+	template<typename T, size_t N, typename Alloc>
+	void swap(SmallVector<T, N, Alloc> &lhs, SmallVector<T, N, Alloc> &rhs)
+	{
+		lhs.swap(rhs);
+	}
+}
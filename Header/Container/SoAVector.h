@@ -0,0 +1,724 @@
+#pragma once
+
+// SoAVector header
+
+// Mini-STL header
+#include <Config/Config.h>
+#include <Alloc/Allocator.h>
+#include <TypeInfo/TypeTraits.h>
+#include <Container/Vector.h>
+
+// STL header and cpp standard header
+#include <stdexcept>
+#include <cstring>
+
+namespace MSTD {
+
+	// Indices 0, 1, ..., N - 1 as a pack
+	template<size_t... Is>
+	struct _IndexSequence {};
+
+	template<size_t N, size_t... Is>
+	struct _MakeIndexSequence : _MakeIndexSequence<N - 1, N - 1, Is...> {};
+
+	template<size_t... Is>
+	struct _MakeIndexSequence<0, Is...>
+	{
+		using type = _IndexSequence<Is...>;
+	};
+
+	// The {I}th type of {T, Types...}
+	template<size_t I, typename T, typename... Types>
+	struct _TypeAt : _TypeAt<I - 1, Types...> {};
+
+	template<typename T, typename... Types>
+	struct _TypeAt<0, T, Types...>
+	{
+		using type = T;
+	};
+
+	// Evaluates a pack expansion in order
+	using _Expand = int[];
+
+	// Contiguous elements of a column of SoAVector,
+	// iterated by plain pointers, so it can be passed
+	// to algorithms like accumulate() directly
+	template<typename T>
+	class ColumnSpan
+	{
+	public:
+		using ValueType = typename removeConst<T>::type;
+		using SizeType = size_t;
+		using Pointer = T*;
+		using Reference = T&;
+		using Iterator = T*;
+
+		ColumnSpan() noexcept :
+			_ptr(nullptr),
+			_size(0)
+		{}
+
+		ColumnSpan(Pointer ptr, SizeType size) noexcept :
+			_ptr(ptr),
+			_size(size)
+		{}
+
+		// Span of elements is also a span of const elements
+		template<typename U, typename = typename enableIf<isSame<const U, T>::value>::type>
+		ColumnSpan(const ColumnSpan<U> &that) noexcept :
+			_ptr(that.data()),
+			_size(that.size())
+		{}
+
+		Iterator begin() const noexcept { return _ptr; }
+		Iterator end() const noexcept { return _ptr + _size; }
+
+		Pointer data() const noexcept { return _ptr; }
+		SizeType size() const noexcept { return _size; }
+		bool empty() const noexcept { return _size == 0; }
+
+		Reference operator[](SizeType pos) const { return _ptr[pos]; }
+		Reference front() const { return _ptr[0]; }
+		Reference back() const { return _ptr[_size - 1]; }
+
+	private:
+		Pointer _ptr;
+		SizeType _size;
+	};
+
+	// SoAVector<Fields...>
+	// Rows of {Fields...} stored as structure of arrays,
+	// each field lives in its own contiguous column, so
+	// a loop reading some fields doesn't pull the others
+	// into cache. All columns share one block, one size
+	// and one capacity, which grows like Vector's
+	template<typename... Fields>
+	class SoAVector
+	{
+		static_assert(sizeof...(Fields) > 0, "SoAVector needs one field at least");
+
+		// Storage is counted in cache lines and every
+		// column starts at one of them
+		struct alignas(_CACHE_LINE_SIZE) _Line
+		{
+			unsigned char bytes[_CACHE_LINE_SIZE];
+		};
+
+		using _LineAlloc = Allocator<_Line>;
+		using _Indices = typename _MakeIndexSequence<sizeof...(Fields)>::type;
+
+		template<size_t I>
+		using _Index = integralConstant<size_t, I>;
+
+		using _End = _Index<sizeof...(Fields)>;
+
+		// Block of all columns, {capacity} rows fit in it
+		struct _Storage
+		{
+			_Line *block;
+			size_t lines;
+			size_t capacity;
+			void *columns[sizeof...(Fields)];
+		};
+
+	public:
+		using SizeType = size_t;
+		using DifferenceType = ptrdiff_t;
+
+		template<size_t I>
+		using FieldType = typename _TypeAt<I, Fields...>::type;
+
+		// Proxy of a row, its fields are got by get<I>()
+		class RowReference
+		{
+		public:
+			template<size_t I>
+			FieldType<I>& get() const
+			{
+				return _vec->template _column<I>(_vec->_storage)[_pos];
+			}
+
+			SizeType index() const noexcept { return _pos; }
+
+		private:
+			friend class SoAVector;
+
+			RowReference(SoAVector *vec, SizeType pos) noexcept :
+				_vec(vec),
+				_pos(pos)
+			{}
+
+			SoAVector *_vec;
+			SizeType _pos;
+		};
+
+		class ConstRowReference
+		{
+		public:
+			ConstRowReference(const RowReference &row) noexcept :
+				_vec(row._vec),
+				_pos(row._pos)
+			{}
+
+			template<size_t I>
+			const FieldType<I>& get() const
+			{
+				return _vec->template _column<I>(_vec->_storage)[_pos];
+			}
+
+			SizeType index() const noexcept { return _pos; }
+
+		private:
+			friend class SoAVector;
+
+			ConstRowReference(const SoAVector *vec, SizeType pos) noexcept :
+				_vec(vec),
+				_pos(pos)
+			{}
+
+			const SoAVector *_vec;
+			SizeType _pos;
+		};
+
+		// Constructor
+		SoAVector() noexcept :
+			_storage(),
+			_size(0)
+		{}
+
+		// Construct with {count} value-initialized rows
+		explicit SoAVector(SizeType count) :
+			SoAVector()
+		{
+			resize(count);
+		}
+
+		SoAVector(const SoAVector &that) :
+			SoAVector()
+		{
+			if (!that.empty()) {
+				auto storage = _allocate(that._size);
+				_MSTD_TRY
+					_copyColumns(that._storage.columns, storage.columns, that._size, _Index<0>());
+				_MSTD_CATCH_ALL
+					_deallocate(storage);
+					throw;
+				_MSTD_END_CATCH
+				_storage = storage;
+				_size = that._size;
+			}
+		}
+
+		SoAVector(SoAVector &&that) noexcept :
+			_storage(that._storage),
+			_size(that._size)
+		{
+			that._storage = _Storage();
+			that._size = 0;
+		}
+
+		// Destructor
+		~SoAVector()
+		{
+			_destroyRows(_storage, 0, _size);
+			_deallocate(_storage);
+		}
+
+		SoAVector& operator=(const SoAVector &that)
+		{
+			if (&that != this) {
+				SoAVector tmp(that);
+				swap(tmp);
+			}
+			return *this;
+		}
+
+		SoAVector& operator=(SoAVector &&that) noexcept
+		{
+			if (&that != this) {
+				SoAVector tmp(MSTD::move(that));
+				swap(tmp);
+			}
+			return *this;
+		}
+
+		static constexpr SizeType fieldCount() noexcept { return sizeof...(Fields); }
+
+		// Row access
+		RowReference operator[](SizeType pos) noexcept
+		{
+			return RowReference(this, pos);
+		}
+
+		ConstRowReference operator[](SizeType pos) const noexcept
+		{
+			return ConstRowReference(this, pos);
+		}
+
+		RowReference at(SizeType pos)
+		{
+			if (pos >= _size) {
+				throw std::out_of_range("Invalid index to access");
+			}
+			return RowReference(this, pos);
+		}
+
+		ConstRowReference at(SizeType pos) const
+		{
+			if (pos >= _size) {
+				throw std::out_of_range("Invalid index to access");
+			}
+			return ConstRowReference(this, pos);
+		}
+
+		RowReference front() noexcept { return RowReference(this, 0); }
+		ConstRowReference front() const noexcept { return ConstRowReference(this, 0); }
+		RowReference back() noexcept { return RowReference(this, _size - 1); }
+		ConstRowReference back() const noexcept { return ConstRowReference(this, _size - 1); }
+
+		// Column access, fields {I} of all rows
+		template<size_t I>
+		ColumnSpan<FieldType<I>> column() noexcept
+		{
+			return ColumnSpan<FieldType<I>>(_column<I>(_storage), _size);
+		}
+
+		template<size_t I>
+		ColumnSpan<const FieldType<I>> column() const noexcept
+		{
+			return ColumnSpan<const FieldType<I>>(_column<I>(_storage), _size);
+		}
+
+		// Capacity
+		bool empty() const noexcept { return _size == 0; }
+
+		SizeType size() const noexcept { return _size; }
+
+		SizeType capacity() const noexcept { return _storage.capacity; }
+
+		void reserve(SizeType newCap)
+		{
+			if (newCap > capacity()) {
+				_relocate(_allocate(newCap));
+			}
+		}
+
+		void shrinkToFit()
+		{
+			if (_size == 0) {
+				_deallocate(_storage);
+				_storage = _Storage();
+			}
+			else if (_size < capacity()) {
+				auto newStorage = _allocate(_size);
+				if (newStorage.capacity < capacity()) {
+					_relocate(newStorage);
+				}
+				else {
+					_deallocate(newStorage);
+				}
+			}
+		}
+
+		// Modifiers
+		void clear() noexcept
+		{
+			_destroyRows(_storage, 0, _size);
+			_size = 0;
+		}
+
+		void pushBack(const Fields&... vals)
+		{
+			emplaceBack(vals...);
+		}
+
+		void pushBack(Fields&&... vals)
+		{
+			emplaceBack(MSTD::move(vals)...);
+		}
+
+		// Append a row, field {I} is constructed from
+		// the {I}th argument
+		template<typename... Args>
+		void emplaceBack(Args&&... args)
+		{
+			static_assert(sizeof...(Args) == sizeof...(Fields),
+				"A row is constructed from one argument per field");
+
+			if (_size == capacity()) {
+				_growAndEmplaceBack(MSTD::forward<Args>(args)...);
+			}
+			else {
+				_constructRow(_storage, _size, _Index<0>(), MSTD::forward<Args>(args)...);
+			}
+			++_size;
+		}
+
+		void popBack()
+		{
+			--_size;
+			_destroyRows(_storage, _size, _size + 1);
+		}
+
+		// Resize to {count} rows, new ones are value-initialized
+		void resize(SizeType count)
+		{
+			if (count <= _size) {
+				_destroyRows(_storage, count, _size);
+			}
+			else {
+				if (count > capacity()) {
+					reserve(_getGrownCapacity(count - _size));
+				}
+				_valueInitColumns(_storage, _size, count, _Index<0>());
+			}
+			_size = count;
+		}
+
+		void swap(SoAVector &that) noexcept
+		{
+			auto tmp = _storage;
+			_storage = that._storage;
+			that._storage = tmp;
+
+			auto size = _size;
+			_size = that._size;
+			that._size = size;
+		}
+
+	private:
+		_Storage _storage;
+		SizeType _size;
+
+		/////////////////////////////////////
+		//
+		//		private utilities
+		//
+		/////////////////////////////////////
+
+		template<size_t I>
+		static FieldType<I>* _column(const _Storage &storage) noexcept
+		{
+			return static_cast<FieldType<I>*>(storage.columns[I]);
+		}
+
+		// Lines taken by a column of {count} elements of {elemSize}
+		static SizeType _linesOf(SizeType count, SizeType elemSize) noexcept
+		{
+			return (count * elemSize + _CACHE_LINE_SIZE - 1) / _CACHE_LINE_SIZE;
+		}
+
+		// Storage of at least {reqSize} rows. Lines of every column
+		// are filled up, so more rows than that may fit
+		static _Storage _allocate(SizeType reqSize)
+		{
+			_Storage storage;
+			storage.capacity = static_cast<SizeType>(-1);
+			SizeType lines = 0;
+			(void)_Expand{ 0, (
+				lines += _linesOf(reqSize, sizeof(Fields)),
+				storage.capacity = _minCapacity(storage.capacity, _linesOf(reqSize, sizeof(Fields)), sizeof(Fields)),
+				0)...
+			};
+
+			_LineAlloc alloc;
+			auto result = AllocatorTraits<_LineAlloc>::allocateAtLeast(alloc, lines);
+			storage.block = result.ptr;
+			storage.lines = result.count;
+			_layout(storage, storage.block, _Indices());
+			return storage;
+		}
+
+		static SizeType _minCapacity(SizeType cap, SizeType lines, SizeType elemSize) noexcept
+		{
+			auto fit = lines * _CACHE_LINE_SIZE / elemSize;
+			return fit < cap ? fit : cap;
+		}
+
+		// Columns of {storage} follow one another from {cur}
+		template<size_t... Is>
+		static void _layout(_Storage &storage, _Line *cur, _IndexSequence<Is...>) noexcept
+		{
+			(void)_Expand{ 0, (
+				storage.columns[Is] = cur,
+				cur += _linesOf(storage.capacity, sizeof(Fields)),
+				0)...
+			};
+		}
+
+		static void _deallocate(const _Storage &storage)
+		{
+			if (storage.block != nullptr) {
+				_LineAlloc alloc;
+				AllocatorTraits<_LineAlloc>::deallocate(alloc, storage.block, storage.lines);
+			}
+		}
+
+		SizeType _getGrownCapacity(SizeType reqSize) const noexcept
+		{
+			if (capacity() == 0) {
+				return reqSize;
+			}
+			else {
+				return static_cast<SizeType>(DoubleGrowth::grow(capacity(), reqSize + _size, _rowSize()));
+			}
+		}
+
+		static constexpr SizeType _rowSize() noexcept
+		{
+			return _sumOf(sizeof(Fields)...);
+		}
+
+		static constexpr SizeType _sumOf(SizeType n) noexcept
+		{
+			return n;
+		}
+
+		template<typename... Sizes>
+		static constexpr SizeType _sumOf(SizeType n, Sizes... rest) noexcept
+		{
+			return n + _sumOf(rest...);
+		}
+
+		template<typename T>
+		static void _destroyRange(T *first, T *last) noexcept
+		{
+			for (; first != last; ++first) {
+				first->~T();
+			}
+		}
+
+		// Destroy rows [first, last) of {storage}
+		static void _destroyRows(const _Storage &storage, SizeType first, SizeType last) noexcept
+		{
+			_auxDestroyRows(storage, first, last, _Indices());
+		}
+
+		template<size_t... Is>
+		static void _auxDestroyRows(const _Storage &storage, SizeType first, SizeType last,
+									_IndexSequence<Is...>) noexcept
+		{
+			(void)_Expand{ 0, (_destroyRange(_column<Is>(storage) + first, _column<Is>(storage) + last), 0)... };
+		}
+
+		// Construct field {I} and on of row {pos} from {args},
+		// none is left if it fails
+		template<size_t I, typename Arg, typename... Args>
+		static void _constructRow(const _Storage &storage, SizeType pos, _Index<I>, Arg &&arg, Args&&... args)
+		{
+			using T = FieldType<I>;
+			auto p = _column<I>(storage) + pos;
+			::new (static_cast<void*>(p)) T(MSTD::forward<Arg>(arg));
+			_MSTD_TRY
+				_constructRow(storage, pos, _Index<I + 1>(), MSTD::forward<Args>(args)...);
+			_MSTD_CATCH_ALL
+				p->~T();
+				throw;
+			_MSTD_END_CATCH
+		}
+
+		static void _constructRow(const _Storage &, SizeType, _End) noexcept {}
+
+		// Value-initialize rows [first, last) of columns {I} and on
+		template<size_t I>
+		static void _valueInitColumns(const _Storage &storage, SizeType first, SizeType last, _Index<I>)
+		{
+			using T = FieldType<I>;
+			auto beg = _column<I>(storage) + first;
+			auto end = _column<I>(storage) + last;
+			auto cur = beg;
+			_MSTD_TRY
+				for (; cur != end; ++cur) {
+					::new (static_cast<void*>(cur)) T();
+				}
+				_valueInitColumns(storage, first, last, _Index<I + 1>());
+			_MSTD_CATCH_ALL
+				_destroyRange(beg, cur);
+				throw;
+			_MSTD_END_CATCH
+		}
+
+		static void _valueInitColumns(const _Storage &, SizeType, SizeType, _End) noexcept {}
+
+		// Copy {count} rows of {src} to columns {dest} from {I} on
+		template<size_t I>
+		static void _copyColumns(void *const *src, void *const *dest, SizeType count, _Index<I>)
+		{
+			using T = FieldType<I>;
+			auto from = static_cast<const T*>(src[I]);
+			auto first = static_cast<T*>(dest[I]);
+			uninitializedCopy(from, from + count, first);
+			_MSTD_TRY
+				_copyColumns(src, dest, count, _Index<I + 1>());
+			_MSTD_CATCH_ALL
+				_destroyRange(first, first + count);
+				throw;
+			_MSTD_END_CATCH
+		}
+
+		static void _copyColumns(void *const *, void *const *, SizeType, _End) noexcept {}
+
+		template<typename T>
+		using _IsRelocatable = typename conditional<
+			isTriviallyRelocatable<T>::value, trueType, falseType
+		>::type;
+
+		// Moving elements of {T} may throw, so they are copied
+		template<typename T>
+		using _IsCopiedOnMove = typename conditional<
+			!isTriviallyRelocatable<T>::value && !isNothrowMoveConstructible<T>::value,
+			trueType, falseType
+		>::type;
+
+		template<typename T>
+		static void _copyOnMove(T *first, T *last, T *dest, trueType)
+		{
+			uninitializedCopy(first, last, dest);
+		}
+
+		template<typename T>
+		static void _copyOnMove(T *, T *, T *, falseType) noexcept {}
+
+		template<typename T>
+		static void _cleanUpCopied(T *first, T *last, trueType) noexcept
+		{
+			_destroyRange(first, last);
+		}
+
+		template<typename T>
+		static void _cleanUpCopied(T *, T *, falseType) noexcept {}
+
+		// Copy {count} rows of {src} to {dest} in columns from {I}
+		// on which are copied on move, none is left if it fails
+		template<size_t I>
+		static void _copyColumnsOnMove(const _Storage &src, const _Storage &dest, SizeType count, _Index<I>)
+		{
+			using T = FieldType<I>;
+			auto first = _column<I>(src);
+			auto newFirst = _column<I>(dest);
+			_copyOnMove(first, first + count, newFirst, _IsCopiedOnMove<T>());
+			_MSTD_TRY
+				_copyColumnsOnMove(src, dest, count, _Index<I + 1>());
+			_MSTD_CATCH_ALL
+				_cleanUpCopied(newFirst, newFirst + count, _IsCopiedOnMove<T>());
+				throw;
+			_MSTD_END_CATCH
+		}
+
+		static void _copyColumnsOnMove(const _Storage &, const _Storage &, SizeType, _End) noexcept {}
+
+		// Trivially relocatable, bytes are copied at once
+		template<typename T>
+		static void _moveNothrow(T *first, T *last, T *dest, trueType) noexcept
+		{
+			if (first != last) {
+				std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first),
+							(last - first) * sizeof(T));
+			}
+		}
+
+		template<typename T>
+		static void _moveNothrow(T *first, T *last, T *dest, falseType) noexcept
+		{
+			uninitializedCopy(MoveIterator<T*>(first), MoveIterator<T*>(last), dest);
+		}
+
+		template<typename T>
+		static void _auxMoveColumn(T *first, T *last, T *dest, falseType) noexcept
+		{
+			_moveNothrow(first, last, dest, _IsRelocatable<T>());
+		}
+
+		template<typename T>
+		static void _auxMoveColumn(T *, T *, T *, trueType) noexcept {}
+
+		template<size_t... Is>
+		static void _moveColumns(const _Storage &src, const _Storage &dest, SizeType count,
+								_IndexSequence<Is...>) noexcept
+		{
+			(void)_Expand{ 0, (
+				_auxMoveColumn(_column<Is>(src), _column<Is>(src) + count, _column<Is>(dest),
+							   _IsCopiedOnMove<FieldType<Is>>()),
+				0)...
+			};
+		}
+
+		// Move {count} rows of {src} to {dest}. Columns which may
+		// throw are copied first, then the others are moved, which
+		// never throws, so {src} is left intact if it fails
+		static void _moveRows(const _Storage &src, const _Storage &dest, SizeType count)
+		{
+			_copyColumnsOnMove(src, dest, count, _Index<0>());
+			_moveColumns(src, dest, count, _Indices());
+		}
+
+		// Old elements are destroyed after moving, relocated
+		// ones are owned by new storage
+		template<typename T>
+		static void _destroyMoved(T *first, T *last, falseType) noexcept
+		{
+			_destroyRange(first, last);
+		}
+
+		template<typename T>
+		static void _destroyMoved(T *, T *, trueType) noexcept {}
+
+		template<size_t... Is>
+		void _destroyMovedRows(_IndexSequence<Is...>) noexcept
+		{
+			(void)_Expand{ 0, (
+				_destroyMoved(_column<Is>(_storage), _column<Is>(_storage) + _size, _IsRelocatable<FieldType<Is>>()),
+				0)...
+			};
+		}
+
+		// Move all rows to {newStorage} and drop the old one
+		void _relocate(const _Storage &newStorage)
+		{
+			_MSTD_TRY
+				_moveRows(_storage, newStorage, _size);
+			_MSTD_CATCH_ALL
+				_deallocate(newStorage);
+				throw;
+			_MSTD_END_CATCH
+			_destroyMovedRows(_Indices());
+			_deallocate(_storage);
+			_storage = newStorage;
+		}
+
+		// New row is constructed in grown storage before
+		// rows are moved, as {args} may refer to them
+		template<typename... Args>
+		void _growAndEmplaceBack(Args&&... args)
+		{
+			auto newStorage = _allocate(_getGrownCapacity(1));
+			_MSTD_TRY
+				_constructRow(newStorage, _size, _Index<0>(), MSTD::forward<Args>(args)...);
+			_MSTD_CATCH_ALL
+				_deallocate(newStorage);
+				throw;
+			_MSTD_END_CATCH
+
+			_MSTD_TRY
+				_moveRows(_storage, newStorage, _size);
+			_MSTD_CATCH_ALL
+				_destroyRows(newStorage, _size, _size + 1);
+				_deallocate(newStorage);
+				throw;
+			_MSTD_END_CATCH
+			_destroyMovedRows(_Indices());
+			_deallocate(_storage);
+			_storage = newStorage;
+		}
+	};
+
+	template<typename... Fields>
+	void swap(SoAVector<Fields...> &lhs, SoAVector<Fields...> &rhs) noexcept
+	{
+		lhs.swap(rhs);
+	}
+
+	// Rows are moved as a whole block
+	template<typename... Fields>
+	struct isTriviallyRelocatable<SoAVector<Fields...>> : trueType {};
+}
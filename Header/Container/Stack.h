@@ -7,6 +7,7 @@
 #include <Alloc/Allocator.h>
 #include <TypeInfo/TypeTraits.h>
 #include <Iterator/Iterator.h>
+#include <Container/Internal/_Adaptor.h>
 #include <Container/Deque.h>
 
 // STL header and cpp standard header
@@ -111,18 +112,18 @@ namespace MSTD {
 
 		void push(const ValueType &val)
 		{
-			_c.pushBack(val);
+			_adaptorEmplaceBack(_c, val);
 		}
 
 		void push(ValueType &&val)
 		{
-			_c.pushBack(move(val));
+			_adaptorEmplaceBack(_c, move(val));
 		}
 
 		template<typename... Args>
 		void emplace(Args&&... args)
 		{
-			_c.emplaceBack(forward<Args>(args)...);
+			_adaptorEmplaceBack(_c, MSTD::forward<Args>(args)...);
 		}
 
 		void pop()
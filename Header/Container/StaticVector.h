@@ -0,0 +1,617 @@
+#pragma once
+
+// StaticVector header
+
+// Mini-STL header
+#include <Config/Config.h>
+#include <Alloc/Allocator.h>
+#include <TypeInfo/TypeTraits.h>
+#include <Iterator/Iterator.h>
+#include <Algorithm/Algorithm.h>
+#include <Container/Vector.h>
+
+// STL header and cpp standard header
+#include <initializer_list>
+#include <stdexcept>
+
+namespace MSTD {
+
+	// StaticVector<T, N>
+	// Sequence container of at most N elements stored in
+	// an array inside itself, it never allocates.
+	// pushBack() and emplaceBack() are noexcept if the
+	// element is nothrow constructible, they return false
+	// and leave the vector unchanged when it is full, so
+	// does popBack() when it is empty.
+	// Other operations throw std::length_error if elements
+	// wouldn't fit, so do Stack and PriorityQueue on it
+	template<
+		typename T, // Element type
+		size_t N // Capacity
+	> class StaticVector
+	{
+		static_assert(N > 0, "StaticVector needs room for one element at least");
+
+	public:
+		using DifferenceType = ptrdiff_t;
+		using SizeType = size_t;
+		using ValueType = T;
+		using Reference = ValueType & ;
+		using ConstReference = const ValueType&;
+		using Pointer = ValueType * ;
+		using ConstPointer = const ValueType*;
+		using Iterator = _VecIterator<StaticVector>;
+		using ConstIterator = _VecConstIterator<StaticVector>;
+		using ReverseIterator = MSTD::ReverseIterator<Iterator>;
+		using ConstReverseIterator = MSTD::ReverseIterator<ConstIterator>;
+
+		/////////////////////////////////////
+		//
+		//	Constructors and destructor
+		//
+		/////////////////////////////////////
+
+		StaticVector() noexcept :
+			_size(0)
+		{}
+
+		// {count} value-initialized elements
+		explicit StaticVector(SizeType count) :
+			StaticVector()
+		{
+			resize(count);
+		}
+
+		StaticVector(SizeType count, const ValueType &val) :
+			StaticVector()
+		{
+			resize(count, val);
+		}
+
+		template<
+			typename InputIt,
+			typename = typename enableIf<
+								!isSame<typename IteratorTraits<InputIt>::IteratorCategory, void>::value,
+								void
+			>::type>
+		StaticVector(InputIt first, InputIt last) :
+			StaticVector()
+		{
+			_append(first, last);
+		}
+
+		StaticVector(std::initializer_list<ValueType> li) :
+			StaticVector()
+		{
+			_append(li.begin(), li.end());
+		}
+
+		StaticVector(const StaticVector &that) :
+			StaticVector()
+		{
+			_append(that.begin(), that.end());
+		}
+
+		// Elements are moved one by one, {that} keeps
+		// its moved-from elements
+		StaticVector(StaticVector &&that) noexcept(isNothrowMoveConstructible<ValueType>::value) :
+			StaticVector()
+		{
+			_append(makeMoveIterator(that.begin()), makeMoveIterator(that.end()));
+		}
+
+		~StaticVector() noexcept
+		{
+			clear();
+		}
+
+		StaticVector& operator=(const StaticVector &that)
+		{
+			if (this != &that) {
+				assign(that.begin(), that.end());
+			}
+
+			return *this;
+		}
+
+		StaticVector& operator=(StaticVector &&that) noexcept(isNothrowMoveConstructible<ValueType>::value)
+		{
+			if (this != &that) {
+				clear();
+				_append(makeMoveIterator(that.begin()), makeMoveIterator(that.end()));
+			}
+
+			return *this;
+		}
+
+		StaticVector& operator=(std::initializer_list<ValueType> li)
+		{
+			assign(li.begin(), li.end());
+
+			return *this;
+		}
+
+		void assign(SizeType count, const ValueType &val)
+		{
+			_checkSize(count);
+			clear();
+			resize(count, val);
+		}
+
+		template<
+			typename InputIt,
+			typename = typename enableIf<
+			!isSame<typename IteratorTraits<InputIt>::IteratorCategory, void>::value,
+			void
+		>::type>
+		void assign(InputIt first, InputIt last)
+		{
+			clear();
+			_append(first, last);
+		}
+
+		/////////////////////////////////////
+		//
+		//			 Element access
+		//
+		/////////////////////////////////////
+
+		Reference at(SizeType pos)
+		{
+			if (pos >= _size) {
+				throw std::out_of_range("Invalid index to access");
+			}
+			return _data()[pos];
+		}
+
+		ConstReference at(SizeType pos) const
+		{
+			if (pos >= _size) {
+				throw std::out_of_range("Invalid index to access");
+			}
+			return _data()[pos];
+		}
+
+		Reference operator[](SizeType pos) noexcept
+		{
+			return _data()[pos];
+		}
+
+		ConstReference operator[](SizeType pos) const noexcept
+		{
+			return _data()[pos];
+		}
+
+		Reference front() noexcept
+		{
+			return _data()[0];
+		}
+
+		ConstReference front() const noexcept
+		{
+			return _data()[0];
+		}
+
+		Reference back() noexcept
+		{
+			return _data()[_size - 1];
+		}
+
+		ConstReference back() const noexcept
+		{
+			return _data()[_size - 1];
+		}
+
+		Pointer data() noexcept
+		{
+			return _data();
+		}
+
+		ConstPointer data() const noexcept
+		{
+			return _data();
+		}
+
+		/////////////////////////////////////
+		//
+		//			 Iterators
+		//
+		/////////////////////////////////////
+
+		Iterator begin() noexcept
+		{
+			return Iterator(_data());
+		}
+
+		ConstIterator begin() const noexcept
+		{
+			return ConstIterator(_data());
+		}
+
+		ConstIterator cbegin() const noexcept
+		{
+			return begin();
+		}
+
+		Iterator end() noexcept
+		{
+			return Iterator(_data() + _size);
+		}
+
+		ConstIterator end() const noexcept
+		{
+			return ConstIterator(_data() + _size);
+		}
+
+		ConstIterator cend() const noexcept
+		{
+			return end();
+		}
+
+		ReverseIterator rbegin() noexcept
+		{
+			return ReverseIterator(end());
+		}
+
+		ConstReverseIterator rbegin() const noexcept
+		{
+			return ConstReverseIterator(end());
+		}
+
+		ConstReverseIterator crbegin() const noexcept
+		{
+			return rbegin();
+		}
+
+		ReverseIterator rend() noexcept
+		{
+			return ReverseIterator(begin());
+		}
+
+		ConstReverseIterator rend() const noexcept
+		{
+			return ConstReverseIterator(begin());
+		}
+
+		ConstReverseIterator crend() const noexcept
+		{
+			return rend();
+		}
+
+		/////////////////////////////////////
+		//
+		//			 Capacity
+		//
+		/////////////////////////////////////
+
+		bool empty() const noexcept
+		{
+			return _size == 0;
+		}
+
+		bool full() const noexcept
+		{
+			return _size == N;
+		}
+
+		SizeType size() const noexcept
+		{
+			return _size;
+		}
+
+		static constexpr SizeType maxSize() noexcept
+		{
+			return N;
+		}
+
+		static constexpr SizeType capacity() noexcept
+		{
+			return N;
+		}
+
+		// Only checks {newCap} fits
+		void reserve(SizeType newCap)
+		{
+			_checkSize(newCap);
+		}
+
+		void shrinkToFit() noexcept
+		{
+			// no-op
+		}
+
+		/////////////////////////////////////
+		//
+		//			 Modifiers
+		//
+		/////////////////////////////////////
+
+		void clear() noexcept
+		{
+			_destroyFrom(0);
+		}
+
+		Iterator insert(ConstIterator pos, const ValueType &val)
+		{
+			return emplace(pos, val);
+		}
+
+		Iterator insert(ConstIterator pos, ValueType &&val)
+		{
+			return emplace(pos, MSTD::move(val));
+		}
+
+		Iterator insert(ConstIterator pos, SizeType count, const ValueType &val)
+		{
+			_checkSize(_size + count);
+			SizeType oldSize = _size;
+			_MSTD_TRY
+				for (; count > 0; --count) {
+					_constructBack(val);
+				}
+			_MSTD_CATCH_ALL
+				_destroyFrom(oldSize);
+				throw;
+			_MSTD_END_CATCH
+			return _rotateIn(pos, oldSize);
+		}
+
+		template<
+			typename InputIt,
+			typename = typename enableIf<
+				!isSame<typename IteratorTraits<InputIt>::IteratorCategory, void>::value,
+				void>::type
+		>
+		Iterator insert(ConstIterator pos, InputIt first, InputIt last)
+		{
+			SizeType oldSize = _size;
+			_append(first, last);
+			return _rotateIn(pos, oldSize);
+		}
+
+		Iterator insert(ConstIterator pos, std::initializer_list<ValueType> li)
+		{
+			return insert(pos, li.begin(), li.end());
+		}
+
+		// Elements after {pos} are rotated one by one
+		template<typename... Args>
+		Iterator emplace(ConstIterator pos, Args&&... args)
+		{
+			_checkSize(_size + 1);
+			SizeType oldSize = _size;
+			_constructBack(MSTD::forward<Args>(args)...);
+			return _rotateIn(pos, oldSize);
+		}
+
+		Iterator erase(ConstIterator pos)
+		{
+			return erase(pos, pos + 1);
+		}
+
+		Iterator erase(ConstIterator first, ConstIterator last)
+		{
+			Pointer dest = first.base();
+			if (first != last) {
+				for (Pointer src = last.base(); src != _data() + _size; ++src, ++dest) {
+					*dest = MSTD::move(*src);
+				}
+				_destroyFrom(static_cast<SizeType>(dest - _data()));
+			}
+			return Iterator(first.base());
+		}
+
+		// False if the vector is full
+		bool pushBack(const ValueType &val) noexcept(isNothrowCopyConstructible<ValueType>::value)
+		{
+			return emplaceBack(val);
+		}
+
+		bool pushBack(ValueType &&val) noexcept(isNothrowMoveConstructible<ValueType>::value)
+		{
+			return emplaceBack(MSTD::move(val));
+		}
+
+		template<typename... Args>
+		bool emplaceBack(Args&&... args) noexcept(noexcept(ValueType(MSTD::forward<Args>(args)...)))
+		{
+			if (_size == N) {
+				return false;
+			}
+			_constructBack(MSTD::forward<Args>(args)...);
+			return true;
+		}
+
+		// False if the vector is empty
+		bool popBack() noexcept
+		{
+			if (_size == 0) {
+				return false;
+			}
+			--_size;
+			_data()[_size].~ValueType();
+			return true;
+		}
+
+		void resize(SizeType count)
+		{
+			_checkSize(count);
+			if (count < _size) {
+				_destroyFrom(count);
+				return;
+			}
+			SizeType oldSize = _size;
+			_MSTD_TRY
+				while (_size < count) {
+					_constructBack();
+				}
+			_MSTD_CATCH_ALL
+				_destroyFrom(oldSize);
+				throw;
+			_MSTD_END_CATCH
+		}
+
+		void resize(SizeType count, const ValueType &val)
+		{
+			if (count < _size) {
+				_destroyFrom(count);
+			}
+			else {
+				insert(end(), count - _size, val);
+			}
+		}
+
+		// Common elements are swapped, rest ones are
+		// moved to the shorter one
+		void swap(StaticVector &that) noexcept(isNothrowMoveConstructible<ValueType>::value)
+		{
+			StaticVector &shorter = _size < that._size ? *this : that;
+			StaticVector &longer = _size < that._size ? that : *this;
+			SizeType common = shorter._size;
+			for (SizeType i = 0; i < common; ++i) {
+				using std::swap;
+				swap(_data()[i], that._data()[i]);
+			}
+			for (SizeType i = common; i < longer._size; ++i) {
+				shorter._constructBack(MSTD::move(longer._data()[i]));
+			}
+			longer._destroyFrom(common);
+		}
+
+	private:
+		alignas(ValueType) unsigned char _bytes[N * sizeof(ValueType)];
+		SizeType _size;
+
+		// Iterators hold non-const pointers
+		Pointer _data() const noexcept
+		{
+			return static_cast<Pointer>(static_cast<void*>(const_cast<unsigned char*>(_bytes)));
+		}
+
+		void _checkSize(SizeType count) const
+		{
+			if (count > N) {
+				throw std::length_error("StaticVector can't hold more than N elements");
+			}
+		}
+
+		// Construct one element at the end, which
+		// must be free
+		template<typename... Args>
+		void _constructBack(Args&&... args)
+		{
+			::new (static_cast<void*>(_data() + _size)) ValueType(MSTD::forward<Args>(args)...);
+			++_size;
+		}
+
+		// Destroy elements from {pos} to the end
+		void _destroyFrom(SizeType pos) noexcept
+		{
+			for (SizeType i = pos; i < _size; ++i) {
+				_data()[i].~ValueType();
+			}
+			_size = pos;
+		}
+
+		// Append elements of [first, last), the vector
+		// is unchanged if it fails
+		template<typename InputIt>
+		void _append(InputIt first, InputIt last)
+		{
+			_auxAppend(first, last, typename IteratorTraits<InputIt>::IteratorCategory());
+		}
+
+		// Range is checked to fit before copying
+		template<typename ForwardIt>
+		void _auxAppend(ForwardIt first, ForwardIt last, ForwardIteratorTag)
+		{
+			_checkSize(_size + MSTD::distance(first, last));
+			SizeType oldSize = _size;
+			_MSTD_TRY
+				_size += uninitializedCopy(first, last, _data() + _size) - (_data() + _size);
+			_MSTD_CATCH_ALL
+				_destroyFrom(oldSize);
+				throw;
+			_MSTD_END_CATCH
+		}
+
+		// Single pass range can be read only once, so
+		// each element is checked to fit
+		template<typename InputIt>
+		void _auxAppend(InputIt first, InputIt last, InputIteratorTag)
+		{
+			SizeType oldSize = _size;
+			_MSTD_TRY
+				for (; first != last; ++first) {
+					_checkSize(_size + 1);
+					_constructBack(*first);
+				}
+			_MSTD_CATCH_ALL
+				_destroyFrom(oldSize);
+				throw;
+			_MSTD_END_CATCH
+		}
+
+		// Move elements appended after {oldSize} to {pos}
+		Iterator _rotateIn(ConstIterator pos, SizeType oldSize)
+		{
+			Pointer first = pos.base();
+			MSTD::rotate(first, _data() + oldSize, _data() + _size);
+			return Iterator(first);
+		}
+	};
+
+	// Elements are stored inside, so it can be
+	// relocated if they can
+	template<typename T, size_t N>
+	struct isTriviallyRelocatable<StaticVector<T, N>> : isTriviallyRelocatable<T> {};
+
+	// Compare operations of StaticVector
+	template<typename T, size_t N>
+	bool operator==(const StaticVector<T, N> &lhs,
+					const StaticVector<T, N> &rhs)
+	{
+		return lhs.size() == rhs.size() && MSTD::equal(lhs.begin(), lhs.end(), rhs.begin());
+	}
+
+	template<typename T, size_t N>
+	bool operator!=(const StaticVector<T, N> &lhs,
+					const StaticVector<T, N> &rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	template<typename T, size_t N>
+	bool operator<(const StaticVector<T, N> &lhs,
+				   const StaticVector<T, N> &rhs)
+	{
+		return lexicographicalCompare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	}
+
+	template<typename T, size_t N>
+	bool operator<=(const StaticVector<T, N> &lhs,
+					const StaticVector<T, N> &rhs)
+	{
+		return !(rhs < lhs);
+	}
+
+	template<typename T, size_t N>
+	bool operator>(const StaticVector<T, N> &lhs,
+				   const StaticVector<T, N> &rhs)
+	{
+		return rhs < lhs;
+	}
+
+	template<typename T, size_t N>
+	bool operator>=(const StaticVector<T, N> &lhs,
+					const StaticVector<T, N> &rhs)
+	{
+		return !(lhs < rhs);
+	}
+
+	template<typename T, size_t N>
+	void swap(StaticVector<T, N> &lhs, StaticVector<T, N> &rhs) noexcept(noexcept(lhs.swap(rhs)))
+	{
+		lhs.swap(rhs);
+	}
+}
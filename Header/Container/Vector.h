@@ -11,6 +11,7 @@
 // STL header and cpp standard header
 #include <initializer_list>
 #include <stdexcept>
+#include <cstring>
 
 namespace MSTD {
 
@@ -19,7 +20,7 @@ namespace MSTD {
 	class _VecIterator
 	{
 	public:
-		using IteratorCategory = RandomAccessIteratorTag;
+		using IteratorCategory = ContiguousIteratorTag;
 		using DifferenceType = typename Vec::DifferenceType;
 		using ValueType = typename Vec::ValueType;
 		using Pointer = typename Vec::Pointer;
@@ -35,12 +36,12 @@ namespace MSTD {
 
 		Pointer base() const { return _ptr; }
 
-		Reference operator*()
+		Reference operator*() const
 		{
 			return *_ptr;
 		}
 
-		Pointer operator->()
+		Pointer operator->() const
 		{
 			return base();
 		}
@@ -166,7 +167,7 @@ namespace MSTD {
 	class _VecConstIterator
 	{
 	public:
-		using IteratorCategory = RandomAccessIteratorTag;
+		using IteratorCategory = ContiguousIteratorTag;
 		using DifferenceType = typename Vec::DifferenceType;
 		using ValueType = typename Vec::ValueType;
 		using ConstPointer = typename Vec::ConstPointer;
@@ -188,12 +189,12 @@ namespace MSTD {
 
 		Pointer base() const { return _ptr; }
 
-		ConstReference operator*()
+		ConstReference operator*() const
 		{
 			return *_ptr;
 		}
 
-		ConstPointer operator->()
+		ConstPointer operator->() const
 		{
 			return base();
 		}
@@ -339,9 +340,9 @@ namespace MSTD {
 		{}
 
 		_VecBase(_VecBase &&that) noexcept :
-			_beg(move(that._beg)),
-			_end(move(that._end)),
-			_capacity(move(that._capacity))
+			_beg(MSTD::move(that._beg)),
+			_end(MSTD::move(that._end)),
+			_capacity(MSTD::move(that._capacity))
 		{
 			that._beg = that._end = that._capacity = nullptr;
 		}
@@ -359,9 +360,9 @@ namespace MSTD {
 
 		_VecBase& operator=(_VecBase &&that) noexcept
 		{
-			_beg = move(that._beg);
-			_end = move(that._end);
-			_capacity = move(that._capacity);
+			_beg = MSTD::move(that._beg);
+			_end = MSTD::move(that._end);
+			_capacity = MSTD::move(that._capacity);
 
 			that._beg = that._end = that._capacity = nullptr;
 
@@ -381,12 +382,77 @@ namespace MSTD {
 		Pointer _capacity;
 	};
 
+	// Growth policies of Vector.
+	// grow() gives the new capacity when storage of {cap}
+	// elements of {elemSize} bytes each is too small for 
+	// {minCap} elements, it must be {minCap} at least.
+	// The allocator may round it up further
+
+	// Doubles capacity, the default
+	struct DoubleGrowth
+	{
+		static size_t grow(size_t cap, size_t minCap, size_t) noexcept
+		{
+			return cap * 2 >= minCap ? cap * 2 : minCap;
+		}
+	};
+
+	// Grows capacity by half, freed blocks of a vector
+	// can be reused by itself as it grows
+	struct HalfGrowth
+	{
+		static size_t grow(size_t cap, size_t minCap, size_t) noexcept
+		{
+			auto newCap = cap + cap / 2;
+			return newCap >= minCap ? newCap : minCap;
+		}
+	};
+
+	// Grows capacity by half, storage above a page is
+	// rounded up to whole pages, as pages of large blocks
+	// are mapped as a whole anyway
+	struct PageGrowth
+	{
+		static constexpr size_t _PAGE_SIZE = 4096;
+
+		static size_t grow(size_t cap, size_t minCap, size_t elemSize) noexcept
+		{
+			auto bytes = HalfGrowth::grow(cap, minCap, elemSize) * elemSize;
+			if (bytes >= _PAGE_SIZE) {
+				bytes = (bytes + _PAGE_SIZE - 1) & ~(_PAGE_SIZE - 1);
+			}
+			return bytes / elemSize;
+		}
+	};
+
+	// Steps through size classes of the default allocator,
+	// about a quarter larger each time, so that storage 
+	// keeps up with the elements closely. Storage too large
+	// for the memory pool grows like PageGrowth
+	struct SizeClassGrowth
+	{
+		static size_t grow(size_t cap, size_t minCap, size_t elemSize) noexcept
+		{
+			auto newCap = cap + (cap / 4 > 0 ? cap / 4 : 1);
+			if (newCap < minCap) {
+				newCap = minCap;
+			}
+			auto bytes = newCap * elemSize;
+			if (bytes > POOL_MAX_ALLOC) {
+				return PageGrowth::grow(cap, minCap, elemSize);
+			}
+			return alloc::goodSize(bytes) / elemSize;
+		}
+	};
+
 	// Vector<T>
 	// Vector<T> is a sequence container that encapsulates 
-	// dynamic size arrays.
+	// dynamic size arrays. Its capacity grows as {Growth}
+	// tells, see DoubleGrowth
 	template<
 		typename T, // Element type
-		typename Alloc = Allocator<T> // Standard allocator
+		typename Alloc = Allocator<T>, // Standard allocator
+		typename Growth = DoubleGrowth // Growth policy
 	> class Vector
 	{
 	public:
@@ -435,12 +501,14 @@ namespace MSTD {
 			_MSTD_END_CATCH
 		}
 
+		// {count} elements constructed by the allocator with
+		// no argument, see resize()
 		explicit Vector(SizeType count, const Alloc &alloc = Alloc()) :
 			Vector(alloc)
 		{
 			_MSTD_TRY
 				if (count < _alloc.maxSize()) {
-					_vBase = _reallocate(_getGrownCapacity(count));
+					_resizeInit(count, trueType());
 				}
 			_MSTD_CATCH_ALL
 				_destroy();
@@ -466,21 +534,14 @@ namespace MSTD {
 		}
 
 		Vector(const Vector &that) :
-			Vector(Alloc())
-		{
-			_MSTD_TRY
-				_aux_insertRange(_vBase._beg, that.begin(), that.end());
-			_MSTD_CATCH_ALL
-				_destroy();
-				throw;
-			_MSTD_END_CATCH
-		}
+			Vector(that, that._alloc)
+		{}
 
 		Vector(const Vector &that, const Alloc &alloc) :
 			Vector(alloc)
 		{
 			_MSTD_TRY
-				_aux_insertRange(_vBase._beg, that.begin(), that.end());
+				_aux_insertRange(_vBase._beg, that._vBase._beg, that._vBase._end);
 			_MSTD_CATCH_ALL
 				_destroy();
 				throw;
@@ -488,16 +549,29 @@ namespace MSTD {
 		}
 
 		Vector(Vector &&that) noexcept :
-			_vBase(move(that._vBase)),
-			_alloc(move(that._alloc))
+			_vBase(MSTD::move(that._vBase)),
+			_alloc(MSTD::move(that._alloc))
 		{}
 
-		Vector(Vector &&that, const Alloc &alloc) 
-			try :
-			_vBase(move(that._vBase)),
-			_alloc(alloc)
-		{}
-		catch (...) { throw; }
+		// Steal the storage of {that} only if it is
+		// released by {alloc}, otherwise move elements
+		Vector(Vector &&that, const Alloc &alloc) :
+			Vector(alloc)
+		{
+			if (_alloc == that._alloc) {
+				_vBase = MSTD::move(that._vBase);
+			}
+			else {
+				_MSTD_TRY
+					_aux_insertRange(_vBase._beg, 
+									 makeMoveIterator(that.begin()), 
+									 makeMoveIterator(that.end()));
+				_MSTD_CATCH_ALL
+					_destroy();
+					throw;
+				_MSTD_END_CATCH
+			}
+		}
 
 		Vector(std::initializer_list<ValueType> li, const Alloc &alloc = Alloc()) :
 			Vector(alloc)
@@ -525,8 +599,7 @@ namespace MSTD {
 			if (this != &that) {
 				_destroy();
 				_MSTD_TRY
-					_alloc = that._alloc;
-					_aux_insertRange(_vBase._beg, that.begin(), that.end());
+					_aux_insertRange(_vBase._beg, that._vBase._beg, that._vBase._end);
 				_MSTD_CATCH_ALL
 					_destroy();
 					throw;
@@ -536,11 +609,18 @@ namespace MSTD {
 			return *this;
 		}
 
-		Vector& operator=(Vector &&that) noexcept
+		// Allocator is kept, storage of {that} is stolen
+		// only if both allocators are equal
+		Vector& operator=(Vector &&that)
 		{
 			if (this != &that ) {
-				_vBase = move(that._vBase);
-				_alloc = move(that._alloc);
+				if (_alloc == that._alloc) {
+					_destroy();
+					_vBase = MSTD::move(that._vBase);
+				}
+				else {
+					assign(makeMoveIterator(that.begin()), makeMoveIterator(that.end()));
+				}
 			}
 			
 			return *this;
@@ -548,13 +628,7 @@ namespace MSTD {
 
 		Vector& operator=(std::initializer_list<ValueType> li)
 		{
-			_MSTD_TRY
-				_alloc = AllocatorType();
-				_aux_insertRange(_vBase._beg, li.begin(), li.end());
-			_MSTD_CATCH_ALL
-				_destroy();
-				throw;
-			_MSTD_END_CATCH
+			assign(li.begin(), li.end());
 
 			return *this;
 		}
@@ -746,17 +820,7 @@ namespace MSTD {
 		void reserve(SizeType newCap)
 		{
 			if (newCap > capacity()) {
-				_VecBase<Pointer> newBase;
-				_MSTD_TRY
-					newBase = _reallocate(newCap);
-					newBase._end = _moveRange(_vBase._beg, _vBase._end, newBase._beg);		
-
-					_destroy();
-					_vBase.swap(newBase);
-				_MSTD_CATCH_ALL
-					_cleanUp(newBase);
-					throw;
-				_MSTD_END_CATCH
+				_auxReserve(newCap, _IsRelocatable());
 			}
 		}
 
@@ -774,10 +838,10 @@ namespace MSTD {
 					newBase = _reallocate(newSize);
 					newBase._end = _moveRange(_vBase._beg, _vBase._end, newBase._beg);
 
-					_destroy();
+					_destroyMoved();
 					_vBase.swap(newBase);
 				_MSTD_CATCH_ALL
-					_cleanUp(newBase);
+					_cleanUpMoved(newBase);
 					throw;
 				_MSTD_END_CATCH
 			}
@@ -803,7 +867,7 @@ namespace MSTD {
 
 		Iterator insert(ConstIterator iter, ValueType &&val)
 		{
-			return Iterator(_aux_insert(iter.base(), move(val)));
+			return Iterator(_aux_insert(iter.base(), MSTD::move(val)));
 		}
 
 		Iterator insert(ConstIterator iter, SizeType count, const ValueType &val)
@@ -833,12 +897,12 @@ namespace MSTD {
 			Pointer rawPos = pos.base();
 			if (_hasEnoughCapacity(1)) {
 				if (rawPos == _vBase._end) {
-					_alloc.construct(rawPos, forward<Args>(args)...);
+					_alloc.construct(rawPos, MSTD::forward<Args>(args)...);
 					++_vBase._end;
 				}
 				else {
 					_copyBackward(rawPos, _vBase._end, 1);
-					_alloc.construct(rawPos, forward<Args>(args)...);
+					_alloc.construct(rawPos, MSTD::forward<Args>(args)...);
 				}
 				return Iterator(pos.base());
 			}
@@ -851,16 +915,16 @@ namespace MSTD {
 					newBase._end = _moveRange(_vBase._beg, rawPos, newBase._beg);
 
 					ret = newBase._end;
-					_alloc.construct(newBase._end, forward<Args>(args)...);
+					_alloc.construct(newBase._end, MSTD::forward<Args>(args)...);
 					++newBase._end;
 
 					newBase._end = _moveRange(rawPos, _vBase._end, newBase._end);
 				_MSTD_CATCH_ALL
-					_cleanUp(newBase);
+					_cleanUpMoved(newBase);
 					throw;
 				_MSTD_END_CATCH
 
-				_destroy();
+				_destroyMoved();
 				_vBase.swap(newBase);
 				return Iterator(ret);
 			}
@@ -897,30 +961,18 @@ namespace MSTD {
 
 		void pushBack(ValueType &&val)
 		{
-			emplaceBack(move(val));
+			emplaceBack(MSTD::move(val));
 		}
 
 		template<typename... Args>
 		void emplaceBack(Args&&... args)
 		{
 			if (_hasEnoughCapacity(1)) {
-				_alloc.construct(_vBase._end, forward<Args>(args)...);
+				_alloc.construct(_vBase._end, MSTD::forward<Args>(args)...);
 				++_vBase._end;
 			}
 			else {
-				_VecBase<Pointer> newBase;
-				_MSTD_TRY
-					newBase = _reallocate(_getGrownCapacity(1));
-					newBase._end = _moveRange(_vBase._beg, _vBase._end, newBase._beg);
-					_alloc.construct(newBase._end, forward<Args>(args)...);
-					++newBase._end;
-
-					_destroy();
-					_vBase.swap(newBase);
-				_MSTD_CATCH_ALL
-					_cleanUp(newBase);
-					throw;
-				_MSTD_END_CATCH
+				_growAndEmplaceBack(_IsRelocatable(), MSTD::forward<Args>(args)...);
 			}
 		}
 
@@ -930,9 +982,12 @@ namespace MSTD {
 			--_vBase._end;
 		}
 
+		// New elements are constructed by the allocator with
+		// no argument, which value-initializes them unless it
+		// is a DefaultInitAllocator
 		void resize(SizeType count)
 		{
-			_aux_resize(count);
+			_resizeInit(count, trueType());
 		}
 
 		void resize(SizeType count, const ValueType& val)
@@ -940,6 +995,24 @@ namespace MSTD {
 			_aux_resize(count, val);
 		}
 
+		// New elements are default-initialized, so trivial
+		// ones are left uninitialized to be overwritten
+		void resizeDefaultInit(SizeType count)
+		{
+			_resizeInit(count, falseType());
+		}
+
+		// Append {count} uninitialized elements and return
+		// the first one, to be written in place, e.g. by read()
+		Pointer appendUninitialized(SizeType count)
+		{
+			static_assert(isTriviallyDefaultConstructible<ValueType>::value &&
+						  isTriviallyDestructible<ValueType>::value,
+						  "Only trivial elements can be left uninitialized");
+			_resizeInit(size() + count, falseType());
+			return _vBase._end - count;
+		}
+
 		void swap(Vector &that) noexcept
 		{
 			_vBase.swap(that._vBase);
@@ -952,6 +1025,9 @@ namespace MSTD {
 		Alloc _alloc;
 
 	private:
+		using _IsRelocatable = typename conditional<
+			isTriviallyRelocatable<ValueType>::value, trueType, falseType
+		>::type;
 
 		/////////////////////////////////////
 		//
@@ -959,17 +1035,115 @@ namespace MSTD {
 		//
 		/////////////////////////////////////
 
+		// Not trivially relocatable, elements are moved
+		// to new storage one by one
+		void _auxReserve(SizeType newCap, falseType)
+		{
+			_VecBase<Pointer> newBase;
+			_MSTD_TRY
+				newBase = _reallocate(newCap);
+				newBase._end = _moveRange(_vBase._beg, _vBase._end, newBase._beg);		
+
+				_destroyMoved();
+				_vBase.swap(newBase);
+			_MSTD_CATCH_ALL
+				_cleanUpMoved(newBase);
+				throw;
+			_MSTD_END_CATCH
+		}
+
+		// Trivially relocatable, storage is grown in place
+		// or resized by the allocator as a whole, which
+		// remaps pages of large storage instead of copying
+		void _auxReserve(SizeType newCap, trueType)
+		{
+			using _Traits = AllocatorTraits<Alloc>;
+
+			auto cap = capacity();
+			if (_vBase._beg && _Traits::tryExpandInPlace(_alloc, _vBase._beg, cap, newCap)) {
+				_vBase._capacity = _vBase._beg + newCap;
+				return;
+			}
+
+			auto count = size();
+			auto result = _vBase._beg ?
+				_Traits::reallocate(_alloc, _vBase._beg, cap, newCap) :
+				_Traits::allocateAtLeast(_alloc, newCap);
+			_vBase = _VecBase<Pointer>(result.ptr, result.ptr + count, result.ptr + result.count);
+		}
+
+		template<typename... Args>
+		void _growAndEmplaceBack(falseType, Args&&... args)
+		{
+			_VecBase<Pointer> newBase;
+			_MSTD_TRY
+				newBase = _reallocate(_getGrownCapacity(1));
+				newBase._end = _moveRange(_vBase._beg, _vBase._end, newBase._beg);
+				_alloc.construct(newBase._end, MSTD::forward<Args>(args)...);
+				++newBase._end;
+
+				_destroyMoved();
+				_vBase.swap(newBase);
+			_MSTD_CATCH_ALL
+				_cleanUpMoved(newBase);
+				throw;
+			_MSTD_END_CATCH
+		}
+
+		// The new element is built aside first, as {args} may
+		// refer to elements in storage which is resized, then
+		// it is relocated to the end
+		template<typename... Args>
+		void _growAndEmplaceBack(trueType, Args&&... args)
+		{
+			alignas(ValueType) unsigned char bytes[sizeof(ValueType)];
+			auto elem = static_cast<Pointer>(static_cast<void*>(bytes));
+			_alloc.construct(elem, MSTD::forward<Args>(args)...);
+			_MSTD_TRY
+				_auxReserve(_getGrownCapacity(1), trueType());
+			_MSTD_CATCH_ALL
+				_alloc.destroy(elem);
+				throw;
+			_MSTD_END_CATCH
+
+			std::memcpy(static_cast<void*>(_vBase._end), static_cast<const void*>(elem), sizeof(ValueType));
+			++_vBase._end;
+		}
+
 		// Copy elements from range [start, end) backward {range} position
 		// [start, end) -> [start + range, end + range)
 		void _copyBackward(Pointer first, Pointer last, DifferenceType range)
 		{
-			//for (auto it = last; it > first; --it) {
-			//	::new (static_cast<void*>(it + range)) ValueType(move(*it));
-			//}
-			std::memmove(first + range, first, (last - first) * sizeof(ValueType));
+			_auxCopyBackward(first, last, range, _IsRelocatable());
 			_vBase._end += range;
 		}
 
+		// Not trivially relocatable, move elements one by one
+		// and destroy the old ones, starting from the side
+		// they are moved to
+		void _auxCopyBackward(Pointer first, Pointer last, DifferenceType range, falseType)
+		{
+			if (range > 0) {
+				for (auto it = last; it != first; ) {
+					--it;
+					::new (static_cast<void*>(it + range)) ValueType(MSTD::move(*it));
+					_alloc.destroy(it);
+				}
+			}
+			else {
+				for (auto it = first; it != last; ++it) {
+					::new (static_cast<void*>(it + range)) ValueType(MSTD::move(*it));
+					_alloc.destroy(it);
+				}
+			}
+		}
+
+		void _auxCopyBackward(Pointer first, Pointer last, DifferenceType range, trueType)
+		{
+			std::memmove(static_cast<void*>(first + range), static_cast<const void*>(first),
+						 (last - first) * sizeof(ValueType));
+		}
+
 		// If throw except move construct
 		Pointer _moveNoexcept(Pointer first, Pointer last, Pointer dest, falseType)
 		{
@@ -992,8 +1166,8 @@ namespace MSTD {
 			);
 		}
 
-		// Try to move elements to {dest} from range [start, end)
-		Pointer _moveRange(Pointer start, Pointer end, Pointer dest)
+		// Not trivially relocatable
+		Pointer _auxMoveRange(Pointer start, Pointer end, Pointer dest, falseType)
 		{
 			return _moveNoexcept(
 				start, end, dest,
@@ -1002,6 +1176,65 @@ namespace MSTD {
 			);
 		}
 
+		// Trivially relocatable, copy bytes of all elements
+		// at once, which never throws
+		Pointer _auxMoveRange(Pointer start, Pointer end, Pointer dest, trueType)
+		{
+			if (start != end) {
+				std::memcpy(static_cast<void*>(dest), static_cast<const void*>(start),
+							(end - start) * sizeof(ValueType));
+			}
+			return dest + (end - start);
+		}
+
+		// Try to move elements to {dest} from range [start, end)
+		// in new storage, old elements should be dropped by 
+		// _destroyMoved() and new ones by _cleanUpMoved() on 
+		// failure, as relocated ones may be bytes copied
+		Pointer _moveRange(Pointer start, Pointer end, Pointer dest)
+		{
+			return _auxMoveRange(start, end, dest, _IsRelocatable());
+		}
+
+		// Drop old storage after its elements are moved away
+		void _destroyMoved()
+		{
+			_auxDestroyMoved(_IsRelocatable());
+		}
+
+		void _auxDestroyMoved(falseType)
+		{
+			_destroy();
+		}
+
+		void _auxDestroyMoved(trueType)
+		{
+			// Elements are owned by the new storage now
+			_alloc.deallocate(_vBase._beg, _vBase._capacity - _vBase._beg);
+			_vBase._beg = nullptr;
+			_vBase._end = nullptr;
+			_vBase._capacity = nullptr;
+		}
+
+		// Drop new storage {vBase} if moving fails
+		void _cleanUpMoved(const _VecBase<Pointer> &vBase)
+		{
+			_auxCleanUpMoved(vBase, _IsRelocatable());
+		}
+
+		void _auxCleanUpMoved(const _VecBase<Pointer> &vBase, falseType)
+		{
+			_cleanUp(vBase);
+		}
+
+		void _auxCleanUpMoved(const _VecBase<Pointer> &vBase, trueType)
+		{
+			// Relocated elements are still owned by old storage.
+			// Only relocation, which never throws, may follow 
+			// construction of new elements, so none is left
+			_alloc.deallocate(vBase._beg, vBase._capacity - vBase._beg);
+		}
+
 		// Provide strong guarantee
 		Pointer _aux_insertRange(Pointer pos, SizeType count, const ValueType &val)
 		{				
@@ -1037,12 +1270,12 @@ namespace MSTD {
 						newBase._end
 					);
 				_MSTD_CATCH_ALL
-					_cleanUp(newBase);
+					_cleanUpMoved(newBase);
 					throw;
 				_MSTD_END_CATCH
 
 				// destroy old elements
-				_destroy();
+				_destroyMoved();
 				_vBase.swap(newBase);
 				return ret;
 			}
@@ -1067,12 +1300,12 @@ namespace MSTD {
 					newBase._end = uninitializedCopy(first, last, newBase._end);
 					newBase._end = _moveRange(pos, _vBase._end, newBase._end);
 				_MSTD_CATCH_ALL
-					_cleanUp(newBase);
+					_cleanUpMoved(newBase);
 					throw;
 				_MSTD_END_CATCH
 
 				// destroy old elements
-				_destroy();
+				_destroyMoved();
 				_vBase.swap(newBase);
 				return ret;
 			}
@@ -1085,7 +1318,7 @@ namespace MSTD {
 
 		void _constructHelper(Pointer pos, const ValueType &val, trueType)
 		{
-			::new (static_cast<void*>(pos)) ValueType(move(val));
+			::new (static_cast<void*>(pos)) ValueType(MSTD::move(val));
 		}
 
 		// insert {val} before {pos}
@@ -1111,12 +1344,12 @@ namespace MSTD {
 
 					newBase._end = _moveRange(pos, _vBase._end, newBase._end);
 				_MSTD_CATCH_ALL
-					_cleanUp(newBase);
+					_cleanUpMoved(newBase);
 					throw;
 				_MSTD_END_CATCH
 
 				// destroy old elements
-				_destroy();
+				_destroyMoved();
 				_vBase.swap(newBase);
 
 				return ret;
@@ -1153,12 +1386,12 @@ namespace MSTD {
 
 					newBase._end = _moveRange(pos, _vBase._end, newBase._end);
 				_MSTD_CATCH_ALL
-					_cleanUp(newBase);
+					_cleanUpMoved(newBase);
 					throw;
 				_MSTD_END_CATCH
 
 				// destroy old elements
-				_destroy();
+				_destroyMoved();
 				_vBase.swap(newBase);
 
 				return ret;
@@ -1197,11 +1430,14 @@ namespace MSTD {
 			);
 		}
 
+		// Storage of at least {reqSize} elements, the
+		// allocator may give more
 		_VecBase<Pointer> _reallocate(SizeType reqSize)
-		{			
-			auto newBeg = static_cast<Pointer>(_alloc.allocate(reqSize));
+		{
+			auto result = AllocatorTraits<Alloc>::allocateAtLeast(_alloc, reqSize);
+			auto newBeg = result.ptr;
 			auto newEnd = newBeg;
-			auto newCap = newBeg + reqSize;
+			auto newCap = newBeg + result.count;
 
 			return _VecBase<Pointer>(newBeg, newEnd, newCap);
 		}
@@ -1222,13 +1458,7 @@ namespace MSTD {
 				return reqSize;
 			}
 			else {
-				SizeType minSize = reqSize + size();
-				if (minSize <= capacity() * 2) {
-					return  capacity() * 2;
-				}
-				else {
-					return minSize;
-				}
+				return static_cast<SizeType>(Growth::grow(capacity(), reqSize + size(), sizeof(ValueType)));
 			}
 		}
 
@@ -1237,7 +1467,84 @@ namespace MSTD {
 			return pos < static_cast<SizeType>(_vBase._end - _vBase._beg);
 		}
 
-		void _aux_resize(SizeType count, const ValueType &val = ValueType())
+		// Resize to {count}, new elements are constructed by
+		// the allocator if {ValueInit} is trueType, otherwise
+		// default-initialized. Storage grows like insertion so
+		// repeated appends are amortized
+		template<typename ValueInit>
+		void _resizeInit(SizeType count, ValueInit valueInit)
+		{
+			if (count <= size()) {
+				_destroyFrom(_vBase._beg + count);
+				return;
+			}
+			if (count > capacity()) {
+				reserve(_getGrownCapacity(count - size()));
+			}
+			_constructAtEnd(_vBase._beg + count, valueInit);
+		}
+
+		// Construct elements at the end up to {last} by the
+		// allocator, none is left if it fails
+		void _constructAtEnd(Pointer last, trueType)
+		{
+			Pointer cur = _vBase._end;
+			_MSTD_TRY
+				for (; cur != last; ++cur) {
+					_alloc.construct(cur);
+				}
+			_MSTD_CATCH_ALL
+				for (auto it = _vBase._end; it != cur; ++it) {
+					_alloc.destroy(it);
+				}
+				throw;
+			_MSTD_END_CATCH
+			_vBase._end = last;
+		}
+
+		void _constructAtEnd(Pointer last, falseType)
+		{
+			_defaultInitAtEnd(
+				last,
+				typename conditional<
+					isTriviallyDefaultConstructible<ValueType>::value,
+					trueType, falseType
+				>::type()
+			);
+		}
+
+		// Trivial elements need no initialization
+		void _defaultInitAtEnd(Pointer last, trueType)
+		{
+			_vBase._end = last;
+		}
+
+		void _defaultInitAtEnd(Pointer last, falseType)
+		{
+			Pointer cur = _vBase._end;
+			_MSTD_TRY
+				for (; cur != last; ++cur) {
+					::new (static_cast<void*>(cur)) ValueType;
+				}
+			_MSTD_CATCH_ALL
+				for (auto it = _vBase._end; it != cur; ++it) {
+					_alloc.destroy(it);
+				}
+				throw;
+			_MSTD_END_CATCH
+			_vBase._end = last;
+		}
+
+		// Destroy elements from {pos} to the end
+		void _destroyFrom(Pointer pos)
+		{
+			for (auto it = pos; it < _vBase._end; ++it) {
+				_alloc.destroy(it);
+			}
+			_vBase._end = pos;
+		}
+
+		void _aux_resize(SizeType count, const ValueType &val)
 		{
 			if (count > capacity()) {
 				auto fillCount = count - size();
@@ -1252,19 +1559,20 @@ namespace MSTD {
 				// no-op
 			}
 			else {
-				auto delStart = _vBase._beg + count;
-				for (auto it = delStart; it < _vBase._end; ++it) {
-					_alloc.destroy(it);
-				}
-				_vBase._end = delStart;
+				_destroyFrom(_vBase._beg + count);
 			}
 		}
 	};
 
+	// Vector only points to its storage, so it can be 
+	// relocated if its allocator can
+	template<typename T, typename Alloc, typename Growth>
+	struct isTriviallyRelocatable<Vector<T, Alloc, Growth>> : isTriviallyRelocatable<Alloc> {};
+
 	// Compare operations of Vector
-	template<typename T, typename Alloc>
-	bool operator==(const Vector<T, Alloc> &lhs,
-					const Vector<T, Alloc> &rhs)
+	template<typename T, typename Alloc, typename Growth>
+	bool operator==(const Vector<T, Alloc, Growth> &lhs,
+					const Vector<T, Alloc, Growth> &rhs)
 	{
 		if (lhs.size() == rhs.size()) {
 			for (size_t i = 0; i < lhs.size(); ++i) {
@@ -1278,16 +1586,16 @@ namespace MSTD {
 		return false;
 	}
 
-	template<typename T, typename Alloc>
-	bool operator!=(const Vector<T, Alloc> &lhs,
-					const Vector<T, Alloc> &rhs)
+	template<typename T, typename Alloc, typename Growth>
+	bool operator!=(const Vector<T, Alloc, Growth> &lhs,
+					const Vector<T, Alloc, Growth> &rhs)
 	{
 		return !(lhs == rhs);
 	}
 
-	template<typename T, typename Alloc>
-	bool operator<( const Vector<T, Alloc> &lhs,
-					const Vector<T, Alloc> &rhs)
+	template<typename T, typename Alloc, typename Growth>
+	bool operator<( const Vector<T, Alloc, Growth> &lhs,
+					const Vector<T, Alloc, Growth> &rhs)
 	{
 		size_t i = 0;
 		size_t j = 0;
@@ -1303,9 +1611,9 @@ namespace MSTD {
 		return i == lhs.size() && j != rhs.size();
 	}
 
-	template<typename T, typename Alloc>
-	bool operator<=(const Vector<T, Alloc> &lhs,
-					const Vector<T, Alloc> &rhs)
+	template<typename T, typename Alloc, typename Growth>
+	bool operator<=(const Vector<T, Alloc, Growth> &lhs,
+					const Vector<T, Alloc, Growth> &rhs)
 	{
 		size_t i = 0;
 		size_t j = 0;
@@ -1321,22 +1629,22 @@ namespace MSTD {
 		return i == lhs.size();
 	}
 
-	template<typename T, typename Alloc>
-	bool operator>(const Vector<T, Alloc> &lhs,
-					const Vector<T, Alloc> &rhs)
+	template<typename T, typename Alloc, typename Growth>
+	bool operator>(const Vector<T, Alloc, Growth> &lhs,
+					const Vector<T, Alloc, Growth> &rhs)
 	{
 		return !(lhs <= rhs);
 	}
 
-	template<typename T, typename Alloc>
-	bool operator>=(const Vector<T, Alloc> &lhs,
-					const Vector<T, Alloc> &rhs)
+	template<typename T, typename Alloc, typename Growth>
+	bool operator>=(const Vector<T, Alloc, Growth> &lhs,
+					const Vector<T, Alloc, Growth> &rhs)
 	{
 		return !(lhs < rhs);
 	}
 
-	template<typename T, typename Alloc>
-	void swap(Vector<T, Alloc> &lhs, Vector<T, Alloc> &rhs) noexcept
+	template<typename T, typename Alloc, typename Growth>
+	void swap(Vector<T, Alloc, Growth> &lhs, Vector<T, Alloc, Growth> &rhs) noexcept
 	{
 		lhs.swap(rhs);
 	}
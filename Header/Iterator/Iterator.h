@@ -16,6 +16,9 @@ namespace MSTD {
 	struct ForwardIteratorTag : InputIteratorTag, OutputIteratorTag {};
 	struct BidirectionalIteratorTag : ForwardIteratorTag {};
 	struct RandomAccessIteratorTag : BidirectionalIteratorTag {};
+	// Elements are adjacent in memory, so a range can be
+	// handled through addresses, e.g. by memmove
+	struct ContiguousIteratorTag : RandomAccessIteratorTag {};
 
 	// Register types for classes.
 	// Classes can check the existence of 
@@ -46,7 +49,7 @@ namespace MSTD {
 	template<typename T>
 	struct IteratorTraits<T*>
 	{
-		using IteratorCategory = RandomAccessIteratorTag;
+		using IteratorCategory = ContiguousIteratorTag;
 
 		using DifferenceType = ptrdiff_t;
 
@@ -60,7 +63,7 @@ namespace MSTD {
 	template<typename T>
 	struct IteratorTraits<const T*>
 	{
-		using IteratorCategory = RandomAccessIteratorTag;
+		using IteratorCategory = ContiguousIteratorTag;
 
 		using DifferenceType = ptrdiff_t;
 
@@ -71,6 +74,72 @@ namespace MSTD {
 		using Pointer = const T * ;
 	};
 
+	// {Iter} is a contiguous iterator
+	template<typename Iter>
+	struct isContiguousIterator : integralConstant<bool,
+		isConvertible<typename IteratorTraits<Iter>::IteratorCategory, ContiguousIteratorTag>::value> {};
+
+	// Address of element {p} points to
+	template<typename T>
+	T* _toAddress(T *p) noexcept
+	{
+		return p;
+	}
+
+	// Address of element a contiguous iterator points
+	// to, which may be past the end.
+	// Iterators of class type give it by base()
+	template<typename Iter>
+	auto _toAddress(const Iter &it) noexcept
+		-> decltype(MSTD::_toAddress(it.base()))
+	{
+		return MSTD::_toAddress(it.base());
+	}
+
+	// Segmented iterators walk a sequence of contiguous segments,
+	// e.g. the buffers of a Deque, so algorithms can split a range
+	// into segments and run their contiguous code on each.
+	// Specializations set isSegmented and provide
+	//   SegmentIterator		- iterator over the segments
+	//   LocalIterator		- contiguous iterator within a segment
+	//   segment(it), local(it)	- where {it} is
+	//   begin(seg), end(seg)	- bounds of segment {seg}
+	//   compose(seg, pos)		- iterator at {pos} of {seg}, where
+	//							  {pos} may be end(seg)
+	template<typename Iter>
+	struct SegmentedIteratorTraits
+	{
+		static constexpr bool isSegmented = false;
+	};
+
+	// {Iter} is a segmented iterator
+	template<typename Iter>
+	struct isSegmentedIterator : integralConstant<bool,
+		SegmentedIteratorTraits<Iter>::isSegmented> {};
+
+	// Calls op(first, last) with the local range of every
+	// segment of [first, last) in order
+	template<typename SegmentedIt, typename Op>
+	void _forEachSegment(SegmentedIt first, SegmentedIt last, Op op)
+	{
+		using _Traits = SegmentedIteratorTraits<SegmentedIt>;
+		auto seg = _Traits::segment(first);
+		auto lastSeg = _Traits::segment(last);
+		auto pos = _Traits::local(first);
+		for (; seg != lastSeg; ++seg, pos = _Traits::begin(seg)) {
+			op(pos, _Traits::end(seg));
+		}
+		op(pos, _Traits::local(last));
+	}
+
+	// Adaptors don't address elements in order or yield
+	// lvalues, so they are random access at most
+	template<typename Iter>
+	using _AdaptorCategory = typename conditional<
+		isConvertible<typename IteratorTraits<Iter>::IteratorCategory, ContiguousIteratorTag>::value,
+		RandomAccessIteratorTag,
+		typename IteratorTraits<Iter>::IteratorCategory
+	>::type;
 
 	// Iterator adaptors
 
@@ -78,7 +147,7 @@ namespace MSTD {
 	class ReverseIterator
 	{
 	public:
-		using IteratorCategory = typename IteratorTraits<Iter>::IteratorCategory;
+		using IteratorCategory = _AdaptorCategory<Iter>;
 		using DifferenceType = typename IteratorTraits<Iter>::DifferenceType;
 		using ValueType = typename IteratorTraits<Iter>::ValueType;
 		using Reference = typename IteratorTraits<Iter>::Reference;
@@ -114,7 +183,7 @@ namespace MSTD {
 
 		Pointer operator->() const
 		{
-			return addressof(this->operator*());
+			return MSTD::addressof(this->operator*());
 		}
 
 		ReverseIterator& operator++()
@@ -238,7 +307,7 @@ namespace MSTD {
 	class MoveIterator
 	{
 	public:
-		using IteratorCategory = typename IteratorTraits<Iter>::IteratorCategory;
+		using IteratorCategory = _AdaptorCategory<Iter>;
 		using DifferenceType = typename IteratorTraits<Iter>::DifferenceType;
 		using ValueType = typename IteratorTraits<Iter>::ValueType;
 		using Reference = ValueType && ;
@@ -268,7 +337,7 @@ namespace MSTD {
 
 		Reference operator*() const
 		{
-			return move(*_current);
+			return MSTD::move(*_current);
 		}
 
 		Pointer operator->() const
@@ -326,7 +395,7 @@ namespace MSTD {
 
 		Reference operator[](DifferenceType diff) const
 		{
-			return move(*(_current + diff));
+			return MSTD::move(*(_current + diff));
 		}
 
 	private:
@@ -423,7 +492,7 @@ namespace MSTD {
 		BackInsertIterator&
 			operator=(typename Container::ValueType&& val)
 		{
-			_container->pushBack(move(val));
+			_container->pushBack(MSTD::move(val));
 			return *this;
 		}
 
@@ -477,7 +546,7 @@ namespace MSTD {
 		FrontInsertIterator&
 			operator=(typename Container::ValueType&& val)
 		{
-			_container->pushFront(move(val));
+			_container->pushFront(MSTD::move(val));
 			return *this;
 		}
 
@@ -533,7 +602,7 @@ namespace MSTD {
 		InsertIterator&
 			operator=(typename Container::ValueType&& val)
 		{
-			_iter = _container->insert(_iter, move(val));
+			_iter = _container->insert(_iter, MSTD::move(val));
 			++_iter;
 			return *this;
 		}
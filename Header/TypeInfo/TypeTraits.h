@@ -476,6 +476,16 @@ namespace MSTD {
 	template<typename T>
 	struct hasVirtualDestructor : __hasVirtualDestructor<T> {};
 
+	// Objects of T can be moved to other storage by copying
+	// their bytes, then the old ones are dropped without
+	// calling destructor.
+	// Types holding no pointer into themselves, like Vector,
+	// can specialize it to true
+	template<typename T>
+	struct isTriviallyRelocatable : integralConstant<bool,
+									isTriviallyMoveConstructible<T>::value &&
+									isTriviallyDestructible<T>::value> {};
+
 	// =============== Property queries ===============
 
 	template<typename T>
@@ -0,0 +1,213 @@
+#include <Alloc/MiniAlloc.h>
+#include <Alloc/ArenaAllocator.h>
+#include <Container/Vector.h>
+#include <Container/Deque.h>
+#include <Container/Map.h>
+#include <Container/List.h>
+#include <string>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <vector>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "../BenchUtility.h"
+
+using MSTD::Vector;
+using MSTD::Deque;
+using MSTD::Map;
+using MSTD::List;
+using MSTD::BenchTimer;
+using MSTD::MonotonicArena;
+using MSTD::ArenaAllocator;
+
+// Mapped value whose tree node exceeds 128 bytes
+struct Record
+{
+	double fields[16];
+};
+
+// Many short-lived vectors growing up to 4 KiB
+static void _benchVector()
+{
+	BenchTimer timer;
+	size_t sum = 0;
+	for (int k = 0; k < 20000; ++k) {
+		Vector<int> vec;
+		for (int i = 0; i < 1000; ++i) {
+			vec.pushBack(i);
+		}
+		sum += vec.size();
+	}
+	BENCH_REPORT("Vector<int> x 20000 growing to 1000", timer);
+	(void)sum;
+}
+
+// Deque as a FIFO queue, its buffers are 512 bytes
+static void _benchDeque()
+{
+	BenchTimer timer;
+	Deque<int> que;
+	for (int round = 0; round < 10; ++round) {
+		for (int i = 0; i < 100000; ++i) {
+			que.pushBack(i);
+		}
+		while (!que.empty()) {
+			que.popFront();
+		}
+	}
+	BENCH_REPORT("Deque<int> push/pop 1000000", timer);
+}
+
+static void _benchMap()
+{
+	BenchTimer timer;
+	char key[16];
+	for (int round = 0; round < 5; ++round) {
+		Map<std::string, Record> map;
+		for (int i = 0; i < 50000; ++i) {
+			std::snprintf(key, sizeof(key), "key%d", i);
+			map.emplace(std::string(key), Record());
+		}
+		for (int i = 0; i < 50000; i += 2) {
+			std::snprintf(key, sizeof(key), "key%d", i);
+			map.erase(std::string(key));
+		}
+	}
+	BENCH_REPORT("Map<std::string, Record> 5 x 50000 inserts", timer);
+}
+
+// Tear down of a large index, node by node from the pool
+// versus dropping the whole arena
+static void _benchTeardown()
+{
+	using ArenaMap = Map<int, int, std::less<int>, ArenaAllocator<std::pair<const int, int>>>;
+	const int count = 1000000;
+	{
+		auto map = new Map<int, int>();
+		for (int i = 0; i < count; ++i) {
+			map->emplace(i, i);
+		}
+		BenchTimer timer;
+		delete map;
+		BENCH_REPORT("Map<int, int> teardown of 1000000 nodes", timer);
+	}
+	{
+		MonotonicArena arena;
+		auto map = new ArenaMap(ArenaAllocator<std::pair<const int, int>>(arena));
+		for (int i = 0; i < count; ++i) {
+			map->emplace(i, i);
+		}
+		BenchTimer timer;
+		delete map;
+		arena.release();
+		BENCH_REPORT("Map<int, int> in arena teardown of 1000000 nodes", timer);
+	}
+}
+
+// Random lookups in a tree of millions of nodes, 
+// dominated by TLB misses with 4 KiB pages
+static void _benchMapLookup(const MSTD::ChunkProvider &provider, const char *name)
+{
+	const int count = 2000000;
+	const int lookups = 1000000;
+	auto &old = MSTD::defaultAlloc::setChunkProvider(provider);
+	{
+		std::vector<int> keys(count);
+		for (int i = 0; i < count; ++i) {
+			keys[i] = i;
+		}
+		std::mt19937 rng(42);
+		std::shuffle(keys.begin(), keys.end(), rng);
+
+		Map<int, int> map;
+		for (auto key : keys) {
+			map.emplace(key, key);
+		}
+
+		BenchTimer timer;
+		std::uniform_int_distribution<int> dist(0, count - 1);
+		long long sum = 0;
+		for (int i = 0; i < lookups; ++i) {
+			sum += map.find(dist(rng))->second;
+		}
+		BENCH_REPORT(name, timer);
+		if (sum < 0) {
+			std::cout << sum << std::endl;
+		}
+	}
+	MSTD::defaultAlloc::trim();
+	MSTD::defaultAlloc::setChunkProvider(old);
+}
+
+// Lists built on a producer thread and destroyed on a
+// consumer thread, so every node is freed on a thread
+// other than the one allocating it
+static void _benchProducerConsumer()
+{
+	const int listCnt = 4000;
+	const int nodeCnt = 1000;
+	std::mutex mutex;
+	std::condition_variable ready;
+	std::vector<List<int>*> queue;
+	bool done = false;
+
+	BenchTimer timer;
+	std::thread producer([&]() {
+		for (int k = 0; k < listCnt; ++k) {
+			auto li = new List<int>();
+			for (int i = 0; i < nodeCnt; ++i) {
+				li->pushBack(i);
+			}
+			std::lock_guard<std::mutex> lock(mutex);
+			queue.push_back(li);
+			ready.notify_one();
+		}
+		std::lock_guard<std::mutex> lock(mutex);
+		done = true;
+		ready.notify_one();
+	});
+	std::thread consumer([&]() {
+		std::vector<List<int>*> taken;
+		while (true) {
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				ready.wait(lock, [&]() { return !queue.empty() || done; });
+				if (queue.empty()) {
+					break;
+				}
+				taken.swap(queue);
+			}
+			for (auto li : taken) {
+				delete li;
+			}
+			taken.clear();
+		}
+	});
+	producer.join();
+	consumer.join();
+	BENCH_REPORT("List<int> 4000 x 1000 nodes built on one thread, freed on another", timer);
+}
+
+int main()
+{
+	std::cout << "Memory pool serves requests up to " 
+			<< MSTD::_CentralPool<0>::_MAX_ALLOC << " bytes" << std::endl;
+	_benchVector();
+	_benchDeque();
+	_benchMap();
+	_benchTeardown();
+	_benchProducerConsumer();
+	_benchMapLookup(MSTD::mallocChunkProvider(), 
+		"Map<int, int> 1000000 lookups in 2000000 nodes, malloc chunks");
+	_benchMapLookup(MSTD::hugePageChunkProvider(), 
+		"Map<int, int> 1000000 lookups in 2000000 nodes, huge page chunks");
+
+#ifdef USE_ALLOC_STATS
+	MSTD::defaultAlloc::dumpStats(std::cout);
+#endif // USE_ALLOC_STATS
+
+	return 0;
+}
@@ -0,0 +1,101 @@
+// Refills are counted by statistics of memory pool
+#ifndef USE_ALLOC_STATS
+	#define USE_ALLOC_STATS
+#endif
+
+#include <Alloc/MiniAlloc.h>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <cstdio>
+#include "../BenchUtility.h"
+
+using MSTD::defaultAlloc;
+
+// From hot small classes to large ones, of which fewer
+// blocks are moved at a time
+static const size_t _sizes[] = { 16, 32, 64, 128, 256, 512, 1024, 4096, 16384 };
+
+// Allocations of each thread per size class
+static const size_t _allocs = 500000;
+
+// Allocate blocks of {size} up to a random depth then
+// free all, so the slot drains and overflows in turn.
+// Every allocation is timed on its own
+static void _churn(size_t size, unsigned seed, std::vector<double> &latency)
+{
+	const size_t maxDepth = 2048;
+	std::mt19937 rng(seed);
+	std::uniform_int_distribution<size_t> depthDist(1, maxDepth);
+
+	std::vector<void*> blocks;
+	blocks.reserve(maxDepth);
+	latency.reserve(_allocs);
+	while (latency.size() < _allocs) {
+		size_t depth = depthDist(rng);
+		for (size_t i = 0; i < depth; ++i) {
+			auto start = std::chrono::steady_clock::now();
+			void *p = defaultAlloc::alloc(size);
+			auto end = std::chrono::steady_clock::now();
+			*static_cast<char*>(p) = 1;
+			blocks.push_back(p);
+			latency.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+		}
+		for (auto p : blocks) {
+			defaultAlloc::dealloc(p, size);
+		}
+		blocks.clear();
+	}
+}
+
+// Churn one size class on {threadCnt} threads at once,
+// and report refills and latency of all of them
+static void _benchChurn(size_t size, size_t threadCnt)
+{
+	std::vector<std::vector<double>> latencies(threadCnt);
+	defaultAlloc::trim();
+	auto refillsBefore = defaultAlloc::stats().refills;
+	{
+		std::vector<std::thread> threads;
+		for (size_t t = 0; t < threadCnt; ++t) {
+			threads.emplace_back(_churn, size, static_cast<unsigned>(7 + t), std::ref(latencies[t]));
+		}
+		for (auto &th : threads) {
+			th.join();
+		}
+	}
+	auto refills = defaultAlloc::stats().refills - refillsBefore;
+
+	std::vector<double> latency;
+	for (auto &part : latencies) {
+		latency.insert(latency.end(), part.begin(), part.end());
+	}
+	double mean = 0;
+	for (auto t : latency) {
+		mean += t;
+	}
+	mean /= latency.size();
+
+	std::sort(latency.begin(), latency.end());
+	auto percentile = [&](double q) {
+		return latency[static_cast<size_t>(q * (latency.size() - 1))];
+	};
+	std::printf("%6zu bytes: %7.2f refills per 1000 allocs, "
+				"mean %5.0f ns, p50 %5.0f ns, p99 %6.0f ns, p99.9 %6.0f ns, max %8.0f ns\n",
+				size, 1000.0 * refills / latency.size(), mean,
+				percentile(0.5), percentile(0.99), percentile(0.999), latency.back());
+}
+
+int main()
+{
+	for (size_t threadCnt : { 1, 4 }) {
+		std::printf("Churn on %zu thread(s), %zu allocations per size class each\n", threadCnt, _allocs);
+		for (auto size : _sizes) {
+			_benchChurn(size, threadCnt);
+		}
+	}
+	return 0;
+}
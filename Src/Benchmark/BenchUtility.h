@@ -0,0 +1,48 @@
+#pragma once
+
+// Header for benchmark
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+
+namespace MSTD {
+
+	// Number of malloc calls since program starts.
+	// Only counted with glibc, otherwise always 0
+	size_t mallocCount();
+
+	// Measure time and malloc calls of a code block
+	class BenchTimer
+	{
+	public:
+		BenchTimer() :
+			_start(std::chrono::steady_clock::now()),
+			_malloc(mallocCount())
+		{ }
+
+		double elapsedMs() const
+		{
+			auto d = std::chrono::steady_clock::now() - _start;
+			return std::chrono::duration<double, std::milli>(d).count();
+		}
+
+		size_t mallocCalls() const
+		{
+			return mallocCount() - _malloc;
+		}
+
+	private:
+		std::chrono::steady_clock::time_point _start;
+		size_t _malloc;
+	};
+
+#define BENCH_REPORT(name, timer) \
+	do \
+	{ \
+		double __ms = (timer).elapsedMs(); \
+		size_t __calls = (timer).mallocCalls(); \
+		std::cout << name << ": " << __ms << " ms, " \
+				<< __calls << " malloc calls" << std::endl; \
+	} while (0)
+}
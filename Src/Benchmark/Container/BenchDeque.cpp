@@ -0,0 +1,195 @@
+#include <Container/Deque.h>
+#include <Alloc/Allocator.h>
+#include <Container/Vector.h>
+#include <Algorithm/Algorithm.h>
+#include <Algorithm/Numeric.h>
+#include <iostream>
+#include "../BenchUtility.h"
+
+using MSTD::Deque;
+using MSTD::Vector;
+using MSTD::BenchTimer;
+
+static const int _rounds = 20000000;
+
+// Counts buffers and maps allocated by deques
+static size_t _allocCalls = 0;
+
+template<typename T>
+class CountingAllocator : public MSTD::Allocator<T>
+{
+public:
+	CountingAllocator() = default;
+
+	template<typename U>
+	CountingAllocator(const CountingAllocator<U> &) noexcept {}
+
+	T* allocate(size_t n)
+	{
+		++_allocCalls;
+		return MSTD::Allocator<T>::allocate(n);
+	}
+
+	bool operator==(const CountingAllocator &) const noexcept { return true; }
+	bool operator!=(const CountingAllocator &) const noexcept { return false; }
+};
+
+struct Big
+{
+	char bytes[1020];
+	int val;
+
+	Big(int v = 0) : val(v) {}
+};
+
+// Queue of {backlog} elements pushed at the back and
+// popped at the front, as a work queue in steady state
+template<typename T, size_t BlockSize = MSTD::_DequeBlockSize<T>::value>
+static void _benchQueue(const char *name, int backlog)
+{
+	Deque<T, CountingAllocator<T>, BlockSize> que;
+	for (int i = 0; i < backlog; ++i) {
+		que.pushBack(T(i));
+	}
+
+	auto calls = _allocCalls;
+	BenchTimer timer;
+	long long sum = 0;
+	for (int i = 0; i < _rounds; ++i) {
+		que.pushBack(T(i));
+		sum += que.front().val;
+		que.popFront();
+	}
+	BENCH_REPORT(name, timer);
+	std::cout << "  " << _allocCalls - calls << " allocations" << std::endl;
+	(void)sum;
+}
+
+struct Small
+{
+	int val;
+
+	Small(int v = 0) : val(v) {}
+};
+
+static const size_t _elements = 1 << 22;
+static const int _copies = 50;
+
+// Deques of {_elements} ints built by fill, range and
+// copy constructors
+static void _benchConstruct()
+{
+	Vector<int> src;
+	for (size_t i = 0; i < _elements; ++i) {
+		src.pushBack(static_cast<int>(i));
+	}
+
+	BenchTimer timer;
+	long long sum = 0;
+	for (int k = 0; k < _copies; ++k) {
+		Deque<int> deq(_elements, k);
+		sum += deq.back();
+	}
+	BENCH_REPORT("Deque<int>(count, val)", timer);
+
+	timer = BenchTimer();
+	for (int k = 0; k < _copies; ++k) {
+		Deque<int> deq(src.begin(), src.end());
+		sum += deq.back();
+	}
+	BENCH_REPORT("Deque<int>(first, last) from Vector", timer);
+
+	Deque<int> orig(src.begin(), src.end());
+	timer = BenchTimer();
+	for (int k = 0; k < _copies; ++k) {
+		Deque<int> deq(orig);
+		sum += deq.back();
+	}
+	BENCH_REPORT("Deque<int> copy", timer);
+	(void)sum;
+}
+
+// Pushing {_elements} ints with room reserved up front
+static void _benchReserve()
+{
+	BenchTimer timer;
+	long long sum = 0;
+	for (int k = 0; k < _copies; ++k) {
+		Deque<int> deq;
+		for (size_t i = 0; i < _elements; ++i) {
+			deq.pushBack(static_cast<int>(i));
+		}
+		sum += deq.back();
+	}
+	BENCH_REPORT("Deque<int> pushBack", timer);
+
+	timer = BenchTimer();
+	for (int k = 0; k < _copies; ++k) {
+		Deque<int> deq;
+		deq.reserveBack(_elements);
+		for (size_t i = 0; i < _elements; ++i) {
+			deq.pushBack(static_cast<int>(i));
+		}
+		sum += deq.back();
+	}
+	BENCH_REPORT("Deque<int> pushBack after reserveBack", timer);
+	(void)sum;
+}
+
+// Whole-deque scans by algorithms over {_elements} ints
+static void _benchScan()
+{
+	Deque<int> deq(_elements, 1);
+	Vector<int> out(_elements, 0);
+
+	BenchTimer timer;
+	long long sum = 0;
+	for (int k = 0; k < _copies; ++k) {
+		sum += MSTD::accumulate(deq.begin(), deq.end(), 0LL);
+	}
+	BENCH_REPORT("accumulate over Deque<int>", timer);
+
+	timer = BenchTimer();
+	for (int k = 0; k < _copies; ++k) {
+		sum += MSTD::find(deq.begin(), deq.end(), -1) - deq.begin();
+	}
+	BENCH_REPORT("find over Deque<int>", timer);
+
+	timer = BenchTimer();
+	for (int k = 0; k < _copies; ++k) {
+		MSTD::fill(deq.begin(), deq.end(), k);
+	}
+	BENCH_REPORT("fill over Deque<int>", timer);
+
+	timer = BenchTimer();
+	for (int k = 0; k < _copies; ++k) {
+		MSTD::copy(deq.begin(), deq.end(), out.begin());
+		sum += out[k];
+	}
+	BENCH_REPORT("copy Deque<int> to Vector<int>", timer);
+
+	timer = BenchTimer();
+	for (int k = 0; k < _copies; ++k) {
+		MSTD::copy(out.begin(), out.end(), deq.begin());
+		sum += deq[k];
+	}
+	BENCH_REPORT("copy Vector<int> to Deque<int>", timer);
+	std::cout << "  sum " << sum << std::endl;
+}
+
+int main()
+{
+	// Warm-up, pages of the heap are touched once
+	_benchQueue<Small>("Warm-up", 1000);
+
+	_benchQueue<Small>("Queue of int, backlog 1000", 1000);
+	_benchQueue<Big>("Queue of 1 KiB elements, backlog 100", 100);
+	// One element in a buffer, as when buffers were fixed
+	// to 512 bytes
+	_benchQueue<Big, 1>("Queue of 1 KiB elements in buffers of 1, backlog 100", 100);
+
+	_benchConstruct();
+	_benchReserve();
+	_benchScan();
+	return 0;
+}
@@ -0,0 +1,118 @@
+#include <Container/DynamicBitset.h>
+#include <Container/Vector.h>
+#include <cstdint>
+#include <iostream>
+#include "../BenchUtility.h"
+
+using MSTD::DynamicBitset;
+using MSTD::Vector;
+using MSTD::BenchTimer;
+
+static const size_t _bits = 16 * 1024 * 1024;
+static const int _rounds = 20;
+
+// Positions of about one bit in 64, the same for
+// bitsets and vectors of flags
+static Vector<size_t> _positions()
+{
+	Vector<size_t> ret;
+	uint32_t seed = 7;
+	for (size_t i = 0; i < _bits / 64; ++i) {
+		seed = seed * 1664525u + 1013904223u;
+		ret.pushBack(seed % _bits);
+	}
+	return ret;
+}
+
+static void _benchBitset(const Vector<size_t> &positions)
+{
+	DynamicBitset<> a(_bits);
+	DynamicBitset<> b(_bits);
+	for (size_t i = 0; i < positions.size(); ++i) {
+		(i % 2 ? a : b).set(positions[i]);
+	}
+	std::cout << "DynamicBitset of " << _bits << " bits takes "
+			  << a.wordCount() * sizeof(uint64_t) / 1024 << " KiB" << std::endl;
+
+	BenchTimer timer;
+	size_t sum = 0;
+	for (int k = 0; k < _rounds; ++k) {
+		sum += a.count();
+	}
+	BENCH_REPORT("DynamicBitset count", timer);
+
+	timer = BenchTimer();
+	for (int k = 0; k < _rounds; ++k) {
+		for (auto pos = a.findFirst(); pos != DynamicBitset<>::npos; pos = a.findNext(pos)) {
+			sum += pos;
+		}
+	}
+	BENCH_REPORT("DynamicBitset visit set bits", timer);
+
+	timer = BenchTimer();
+	for (int k = 0; k < _rounds; ++k) {
+		auto c = a;
+		c |= b;
+		c &= a;
+		c ^= b;
+		c.andNot(b);
+		sum += c.any();
+	}
+	BENCH_REPORT("DynamicBitset copy, or, and, xor, and not", timer);
+	std::cout << "  checksum " << sum << std::endl;
+}
+
+static void _benchFlags(const Vector<size_t> &positions)
+{
+	Vector<char> a(_bits, 0);
+	Vector<char> b(_bits, 0);
+	for (size_t i = 0; i < positions.size(); ++i) {
+		(i % 2 ? a : b)[positions[i]] = 1;
+	}
+	std::cout << "Vector<char> of " << _bits << " flags takes "
+			  << a.size() / 1024 << " KiB" << std::endl;
+
+	BenchTimer timer;
+	size_t sum = 0;
+	for (int k = 0; k < _rounds; ++k) {
+		for (auto flag : a) {
+			sum += flag != 0;
+		}
+	}
+	BENCH_REPORT("Vector<char> count", timer);
+
+	timer = BenchTimer();
+	for (int k = 0; k < _rounds; ++k) {
+		for (size_t i = 0; i < _bits; ++i) {
+			if (a[i]) {
+				sum += i;
+			}
+		}
+	}
+	BENCH_REPORT("Vector<char> visit set flags", timer);
+
+	timer = BenchTimer();
+	for (int k = 0; k < _rounds; ++k) {
+		auto c = a;
+		bool any = false;
+		for (size_t i = 0; i < _bits; ++i) {
+			char v = c[i] | b[i];
+			v &= a[i];
+			v ^= b[i];
+			v &= !b[i];
+			c[i] = v;
+			any = any || v;
+		}
+		sum += any;
+	}
+	BENCH_REPORT("Vector<char> copy, or, and, xor, and not", timer);
+	std::cout << "  checksum " << sum << std::endl;
+}
+
+int main()
+{
+	auto positions = _positions();
+	_benchBitset(positions);
+	_benchFlags(positions);
+	return 0;
+}
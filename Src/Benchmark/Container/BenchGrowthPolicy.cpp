@@ -0,0 +1,66 @@
+#include <Container/Vector.h>
+#include <cstdio>
+#include <cstdint>
+#include <iostream>
+#include "../BenchUtility.h"
+
+using MSTD::Vector;
+using MSTD::Allocator;
+using MSTD::BenchTimer;
+
+static const int _vectors = 2000;
+
+// Final sizes spread evenly over orders of magnitude
+// from 1 to 65536, the same for every policy
+static size_t _finalSize(uint32_t &seed)
+{
+	seed = seed * 1664525u + 1013904223u;
+	auto shift = (seed >> 8) % 17;
+	seed = seed * 1664525u + 1013904223u;
+	return (static_cast<size_t>(1) << shift) + (seed >> 8) % (static_cast<size_t>(1) << shift);
+}
+
+// Vectors of ints pushed back one by one to their final
+// sizes and kept alive, room left unused in their storage
+// is reported against room taken by elements
+template<typename Growth>
+static void _benchPolicy(const char *name)
+{
+	using Vec = Vector<int, Allocator<int>, Growth>;
+
+	Vector<Vec> vecs;
+	vecs.resize(_vectors);
+	uint32_t seed = 42;
+
+	BenchTimer timer;
+	for (auto &vec : vecs) {
+		auto size = _finalSize(seed);
+		for (size_t i = 0; i < size; ++i) {
+			vec.pushBack(static_cast<int>(i));
+		}
+	}
+	char title[96];
+	std::snprintf(title, sizeof(title), "%s push back to %d vectors", name, _vectors);
+	BENCH_REPORT(title, timer);
+
+	size_t used = 0;
+	size_t reserved = 0;
+	for (auto &vec : vecs) {
+		used += vec.size() * sizeof(int);
+		reserved += vec.capacity() * sizeof(int);
+	}
+	std::cout << "  " << used / (1024 * 1024) << " MiB of elements, "
+			  << 100.0 * (reserved - used) / used << "% overhead" << std::endl;
+}
+
+int main()
+{
+	// The first run pays for faulting heap pages in
+	_benchPolicy<MSTD::DoubleGrowth>("Warm-up");
+
+	_benchPolicy<MSTD::DoubleGrowth>("DoubleGrowth");
+	_benchPolicy<MSTD::HalfGrowth>("HalfGrowth");
+	_benchPolicy<MSTD::PageGrowth>("PageGrowth");
+	_benchPolicy<MSTD::SizeClassGrowth>("SizeClassGrowth");
+	return 0;
+}
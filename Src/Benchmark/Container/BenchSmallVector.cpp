@@ -0,0 +1,71 @@
+#include <Container/Vector.h>
+#include <Container/SmallVector.h>
+#include <utility>
+#include <cstdio>
+#include "../BenchUtility.h"
+
+using MSTD::Vector;
+using MSTD::SmallVector;
+using MSTD::BenchTimer;
+
+using IntPair = std::pair<int, int>;
+
+static const int _rounds = 2000000;
+
+// Temporaries of {size} elements built and dropped in
+// a loop, as in hot paths
+template<typename Vec>
+static void _benchTemporary(const char *name, int size)
+{
+	BenchTimer timer;
+	long long sum = 0;
+	for (int k = 0; k < _rounds; ++k) {
+		Vec vec;
+		for (int i = 0; i < size; ++i) {
+			vec.emplaceBack(i, k);
+		}
+		sum += vec[size / 2].first;
+	}
+	char title[96];
+	std::snprintf(title, sizeof(title), "%s of %d elements x %d", name, size, _rounds);
+	BENCH_REPORT(title, timer);
+	(void)sum;
+}
+
+// Copies of a small vector
+template<typename Vec>
+static void _benchCopy(const char *name, int size)
+{
+	Vec src;
+	for (int i = 0; i < size; ++i) {
+		src.emplaceBack(i, -i);
+	}
+
+	BenchTimer timer;
+	long long sum = 0;
+	for (int k = 0; k < _rounds; ++k) {
+		Vec copy(src);
+		sum += copy.back().second;
+	}
+	char title[96];
+	std::snprintf(title, sizeof(title), "%s copy of %d elements x %d", name, size, _rounds);
+	BENCH_REPORT(title, timer);
+	(void)sum;
+}
+
+int main()
+{
+	for (int size : { 4, 8, 16 }) {
+		_benchTemporary<Vector<IntPair>>("Vector<pair<int, int>>", size);
+		_benchTemporary<SmallVector<IntPair, 16>>("SmallVector<pair<int, int>, 16>", size);
+	}
+	// Spilled, costs the same as Vector
+	_benchTemporary<Vector<IntPair>>("Vector<pair<int, int>>", 32);
+	_benchTemporary<SmallVector<IntPair, 16>>("SmallVector<pair<int, int>, 16>", 32);
+
+	for (int size : { 4, 16 }) {
+		_benchCopy<Vector<IntPair>>("Vector<pair<int, int>>", size);
+		_benchCopy<SmallVector<IntPair, 16>>("SmallVector<pair<int, int>, 16>", size);
+	}
+	return 0;
+}
@@ -0,0 +1,78 @@
+#include <Container/SoAVector.h>
+#include <Container/Vector.h>
+#include <Algorithm/Numeric.h>
+#include <iostream>
+#include "../BenchUtility.h"
+
+using MSTD::SoAVector;
+using MSTD::Vector;
+using MSTD::BenchTimer;
+
+static const size_t _rows = 4 * 1024 * 1024;
+static const int _rounds = 20;
+
+// Ten fields of 8 bytes, a loop reads only price and weight
+struct Record
+{
+	double price;
+	double weight;
+	double a, b, c, d, e, f;
+	long long id;
+	long long stamp;
+};
+
+using RecordColumns = SoAVector<double, double, double, double, double,
+								double, double, double, long long, long long>;
+
+static void _benchRecords()
+{
+	Vector<Record> recs;
+	recs.reserve(_rows);
+	for (size_t i = 0; i < _rows; ++i) {
+		double v = static_cast<double>(i % 1000);
+		recs.pushBack(Record{ v, v * 0.5, v, v, v, v, v, v,
+							  static_cast<long long>(i), 0 });
+	}
+
+	BenchTimer timer;
+	double sum = 0;
+	for (int k = 0; k < _rounds; ++k) {
+		for (size_t i = 0; i < recs.size(); ++i) {
+			sum += recs[i].price * recs[i].weight;
+		}
+	}
+	BENCH_REPORT("Vector<Record> price * weight", timer);
+	std::cout << "  sum " << sum << std::endl;
+}
+
+static void _benchColumns()
+{
+	RecordColumns rows;
+	rows.reserve(_rows);
+	for (size_t i = 0; i < _rows; ++i) {
+		double v = static_cast<double>(i % 1000);
+		rows.pushBack(v, v * 0.5, v, v, v, v, v, v,
+					  static_cast<long long>(i), 0);
+	}
+
+	BenchTimer timer;
+	double sum = 0;
+	for (int k = 0; k < _rounds; ++k) {
+		auto prices = rows.column<0>();
+		auto weights = rows.column<1>();
+		sum = MSTD::innerProduct(prices.begin(), prices.end(),
+								 weights.begin(), weights.end(), sum);
+	}
+	BENCH_REPORT("SoAVector price * weight", timer);
+	std::cout << "  sum " << sum << std::endl;
+}
+
+int main()
+{
+	// Warm-up, pages of the heap are touched once
+	_benchRecords();
+
+	_benchRecords();
+	_benchColumns();
+	return 0;
+}
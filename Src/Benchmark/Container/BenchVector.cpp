@@ -0,0 +1,84 @@
+#include <Container/Vector.h>
+#include <utility>
+#include <cstdio>
+#include "../BenchUtility.h"
+
+using MSTD::Vector;
+using MSTD::BenchTimer;
+
+using IntPair = std::pair<int, int>;
+
+// Many vectors of pairs growing one by one, every
+// reallocation relocates all elements
+static void _benchPairGrowth()
+{
+	BenchTimer timer;
+	size_t sum = 0;
+	for (int k = 0; k < 2000; ++k) {
+		Vector<IntPair> vec;
+		for (int i = 0; i < 10000; ++i) {
+			vec.emplaceBack(i, k);
+		}
+		sum += vec.size();
+	}
+	BENCH_REPORT("Vector<pair<int, int>> x 2000 growing to 10000", timer);
+	(void)sum;
+}
+
+// Copies of a large vector of pairs
+static void _benchPairCopy()
+{
+	Vector<IntPair> src;
+	for (int i = 0; i < 100000; ++i) {
+		src.emplaceBack(i, -i);
+	}
+
+	BenchTimer timer;
+	size_t sum = 0;
+	for (int k = 0; k < 1000; ++k) {
+		Vector<IntPair> copy(src);
+		sum += copy.size();
+	}
+	BENCH_REPORT("Vector<pair<int, int>> copy of 100000 x 1000", timer);
+	(void)sum;
+}
+
+// Growth of vectors holding vectors, which are relocated
+// instead of moved and destroyed
+static void _benchNestedGrowth()
+{
+	BenchTimer timer;
+	size_t sum = 0;
+	for (int k = 0; k < 200; ++k) {
+		Vector<Vector<int>> vec;
+		for (int i = 0; i < 10000; ++i) {
+			vec.emplaceBack(static_cast<size_t>(2), i);
+		}
+		sum += vec.size();
+	}
+	BENCH_REPORT("Vector<Vector<int>> x 200 growing to 10000", timer);
+	(void)sum;
+}
+
+// One vector growing to 1 GiB, storage of glibc this
+// large is mapped, so it is resized by remapping pages
+static void _benchHugeGrowth()
+{
+	BenchTimer timer;
+	Vector<long long> vec;
+	const long long count = 128LL * 1024 * 1024;
+	for (long long i = 0; i < count; ++i) {
+		vec.pushBack(i);
+	}
+	BENCH_REPORT("Vector<long long> growing to 1 GiB", timer);
+	(void)vec.back();
+}
+
+int main()
+{
+	_benchPairGrowth();
+	_benchPairCopy();
+	_benchNestedGrowth();
+	_benchHugeGrowth();
+	return 0;
+}
@@ -0,0 +1,30 @@
+#include <cstdlib>
+#include <atomic>
+#include "BenchUtility.h"
+
+// Count malloc calls by wrapping the one of glibc
+#if defined(__GLIBC__)
+
+extern "C" void* __libc_malloc(size_t n);
+
+static std::atomic<size_t> _mallocCalls(0);
+
+extern "C" void* malloc(size_t n)
+{
+	_mallocCalls.fetch_add(1, std::memory_order_relaxed);
+	return __libc_malloc(n);
+}
+
+size_t MSTD::mallocCount()
+{
+	return _mallocCalls.load(std::memory_order_relaxed);
+}
+
+#else
+
+size_t MSTD::mallocCount()
+{
+	return 0;
+}
+
+#endif // __GLIBC__
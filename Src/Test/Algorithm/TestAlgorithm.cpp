@@ -2,8 +2,11 @@
 #include <Algorithm/Numeric.h>
 #include <Container/Vector.h>
 #include <Container/List.h>
+#include <Container/Deque.h>
 #include <iostream>
 #include <random>
+#include <string>
+#include "../TestUtility.h"
 
 using MSTD::Vector;
 using MSTD::List;
@@ -178,6 +181,71 @@ void testSort()
 
 }
 
+void testContiguous()
+{
+	using IntIt = Vector<int>::Iterator;
+	EXPECT_BASE(MSTD::isContiguousIterator<IntIt>::value, "Vector iterator isn't contiguous");
+	EXPECT_BASE(MSTD::isContiguousIterator<Vector<int>::ConstIterator>::value, "Vector const iterator isn't contiguous");
+	EXPECT_BASE(MSTD::isContiguousIterator<const int*>::value, "Pointer isn't contiguous");
+	EXPECT_BASE(!MSTD::isContiguousIterator<MSTD::Deque<int>::Iterator>::value, "Deque iterator is contiguous");
+	EXPECT_BASE(!MSTD::isContiguousIterator<List<int>::Iterator>::value, "List iterator is contiguous");
+	EXPECT_BASE(!MSTD::isContiguousIterator<MSTD::ReverseIterator<IntIt>>::value, "Reverse iterator is contiguous");
+	EXPECT_BASE(!MSTD::isContiguousIterator<MSTD::MoveIterator<IntIt>>::value, "Move iterator is contiguous");
+
+	// copy
+	Vector<int> src{ 1, 2, 3, 4, 5, 6, 7, 8 };
+	Vector<int> dest(src.size(), 0);
+	auto end = MSTD::copy(src.cbegin(), src.cend(), dest.begin());
+	EXPECT_BASE(end == dest.end(), "copy returns wrong end");
+	EXPECT_CONTAINER_EQ(dest, src, "copy between vectors failed");
+	MSTD::copy(src.begin(), src.begin() + 4, dest.begin() + 2);
+	Vector<int> shifted{ 1, 2, 1, 2, 3, 4, 7, 8 };
+	EXPECT_CONTAINER_EQ(dest, shifted, "Overlapping copy failed");
+
+	Vector<std::string> strs{ "a", "bb", "ccc" };
+	Vector<std::string> strsCopy(3, "");
+	MSTD::copy(strs.begin(), strs.end(), strsCopy.begin());
+	EXPECT_CONTAINER_EQ(strsCopy, strs, "copy of strings failed");
+
+	// fill
+	Vector<signed char> bytes(10, 0);
+	MSTD::fill(bytes.begin(), bytes.end(), -3);
+	EXPECT_BASE(bytes.front() == -3 && bytes.back() == -3, "fill of bytes failed");
+	auto byteEnd = MSTD::fill_N(bytes.begin(), 4, 'x');
+	EXPECT_BASE(byteEnd == bytes.begin() + 4, "fill_N returns wrong end");
+	EXPECT_BASE(bytes[3] == 'x' && bytes[4] == -3, "fill_N of bytes failed");
+	Vector<bool> flags(5, false);
+	MSTD::fill(flags.begin(), flags.end(), 2);
+	EXPECT_BASE(flags[0] && flags[4], "fill of bools failed");
+	MSTD::fill(dest.begin(), dest.end(), 9);
+	EXPECT_BASE_EQ(dest.back(), 9, "fill of ints failed");
+
+	// equal
+	EXPECT_BASE(MSTD::equal(src.begin(), src.end(), src.cbegin()), "equal of same range failed");
+	EXPECT_BASE(!MSTD::equal(src.begin(), src.end(), shifted.begin()), "equal of different ranges failed");
+	Vector<double> zeros{ 0.0, 1.0 };
+	Vector<double> negZeros{ -0.0, 1.0 };
+	EXPECT_BASE(MSTD::equal(zeros.begin(), zeros.end(), negZeros.begin()), "equal compares bytes of doubles");
+	EXPECT_BASE(MSTD::equal(src.begin(), src.end(), dest.begin(), [](int, int) { return true; }), 
+				"equal ignores compare operation");
+
+	// find
+	Vector<char> chars{ 'a', 'b', 'c', 'd' };
+	EXPECT_BASE(MSTD::find(chars.begin(), chars.end(), 'c') == chars.begin() + 2, "find of byte failed");
+	EXPECT_BASE(MSTD::find(chars.begin(), chars.end(), 'z') == chars.end(), "find of missing byte failed");
+	EXPECT_BASE(MSTD::find(chars.begin(), chars.end(), 'a' + 256) == chars.end(), "find of byte out of range failed");
+	EXPECT_BASE(MSTD::find(src.begin(), src.end(), 5) == src.begin() + 4, "find of int failed");
+	EXPECT_BASE(MSTD::findIf(src.begin(), src.end(), [](int v) { return v > 6; }) == src.begin() + 6, 
+				"findIf failed");
+	List<int> li{ 1, 2, 3 };
+	EXPECT_BASE(MSTD::find(li.begin(), li.end(), 4) == li.end(), "find in list failed");
+
+	// uninitializedCopy
+	alignas(int) char raw[sizeof(int) * 8];
+	auto rawEnd = MSTD::uninitializedCopy(src.cbegin(), src.cend(), reinterpret_cast<int*>(raw));
+	EXPECT_RANGE_EQ(reinterpret_cast<int*>(raw), rawEnd, src.begin(), src.end(), "uninitializedCopy failed");
+}
+
 void testAlgorithm()
 {
 	//testNumeric();
@@ -185,4 +253,5 @@ void testAlgorithm()
 	//testHeap();
 	//testBasic();
 	testSort();
+	testContiguous();
 }
\ No newline at end of file
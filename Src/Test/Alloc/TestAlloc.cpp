@@ -0,0 +1,1161 @@
+#include <Alloc/Allocator.h>
+#include <Alloc/MiniAlloc.h>
+#include <Alloc/ArenaAllocator.h>
+#include <Alloc/MemoryResource.h>
+#include <Container/List.h>
+#include <Container/Vector.h>
+#include <Container/Deque.h>
+#include <Container/Map.h>
+#include <Container/Set.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+#include "../TestUtility.h"
+#include "../TestResource.h"
+
+#if defined(__linux__)
+	#include <unistd.h>
+	#include <sys/wait.h>
+#endif
+
+using MSTD::Allocator;
+using MSTD::List;
+using MSTD::Vector;
+using MSTD::Map;
+using MSTD::Deque;
+using MSTD::Set;
+using MSTD::MonotonicArena;
+using MSTD::ArenaAllocator;
+using MSTD::MemoryResource;
+using MSTD::MonotonicResource;
+using MSTD::PolymorphicAllocator;
+
+struct TestNode
+{
+	size_t owner;
+	size_t seq;
+};
+
+// Allocate and free small blocks from several threads at once,
+// every thread checks that nobody else wrote into its blocks
+static void _testConcurrentAlloc()
+{
+	const size_t threadCnt = 4;
+	const size_t blockCnt = 20000;
+	bool result[threadCnt] = { false };
+
+	auto worker = [&](size_t id) {
+		Allocator<TestNode> alloc;
+		Vector<TestNode*> blocks;
+		bool ok = true;
+		for (size_t round = 0; round < 4; ++round) {
+			for (size_t i = 0; i < blockCnt; ++i) {
+				auto p = alloc.allocate(1);
+				p->owner = id;
+				p->seq = i;
+				blocks.pushBack(p);
+			}
+			for (size_t i = 0; i < blocks.size(); ++i) {
+				ok = ok && blocks[i]->owner == id && blocks[i]->seq == i;
+				alloc.deallocate(blocks[i], 1);
+			}
+			blocks.clear();
+		}
+		result[id] = ok;
+	};
+
+	std::thread threads[threadCnt];
+	for (size_t i = 0; i < threadCnt; ++i) {
+		threads[i] = std::thread(worker, i);
+	}
+	for (auto &t : threads) {
+		t.join();
+	}
+
+	for (size_t i = 0; i < threadCnt; ++i) {
+		EXPECT_BASE(result[i], "Blocks overlapped between threads");
+	}
+}
+
+// Nodes of a List built on one thread are freed on another
+static void _testCrossThreadFree()
+{
+	List<int> *li = nullptr;
+	std::thread producer([&]() {
+		li = new List<int>();
+		for (int i = 0; i < 10000; ++i) {
+			li->pushBack(i);
+		}
+	});
+	producer.join();
+
+	long long sum = 0;
+	std::thread consumer([&]() {
+		for (auto val : *li) {
+			sum += val;
+		}
+		delete li;
+	});
+	consumer.join();
+
+	EXPECT_BASE_EQ(sum, 49995000LL, "List built on another thread is broken");
+
+	// The pool is still usable after both threads exited
+	List<int> li2{ 1, 2, 3 };
+	EXPECT_BASE_EQ(li2.size(), 3u, "Allocation after thread exit failed");
+}
+
+// Every request maps to the smallest size class holding it,
+// wasting less than 1/5 of the block above 128 bytes
+static void _testSizeClass()
+{
+	using Pool = MSTD::_CentralPool<0>;
+	bool ok = true;
+	for (size_t n = 1; n <= Pool::_MAX_ALLOC; ++n) {
+		auto idx = Pool::index(n);
+		auto size = Pool::classSize(idx);
+		ok = ok && idx < Pool::_TABLE_SIZE && size >= n && size % Pool::_BLOCK_SIZE == 0;
+		ok = ok && (idx == 0 || Pool::classSize(idx - 1) < n);
+		ok = ok && (n <= 128 ? size - n < Pool::_BLOCK_SIZE : (size - n) * 5 < size);
+	}
+	EXPECT_BASE(ok, "Size class doesn't fit the request");
+	EXPECT_BASE_EQ(Pool::classSize(Pool::index(512)), 512u, "Deque buffer isn't a size class");
+
+	for (size_t idx = 0; idx < Pool::_TABLE_SIZE; ++idx) {
+		ok = ok && Pool::slabSize(idx) % Pool::_PAGE_SIZE == 0;
+		ok = ok && Pool::slabSize(idx) >= Pool::classSize(idx) * Pool::batchSize(idx);
+	}
+	EXPECT_BASE(ok, "Slab isn't made up of whole pages");
+}
+
+// Blocks of every size class keep their contents
+static void _testMixedSize()
+{
+	Vector<char*> blocks;
+	Vector<size_t> sizes;
+	for (size_t round = 0; round < 3; ++round) {
+		for (size_t n = 1; n <= 32768; n += n / 4 + 1) {
+			auto p = static_cast<char*>(MSTD::defaultAlloc::alloc(n));
+			for (size_t i = 0; i < n; ++i) {
+				p[i] = static_cast<char>(n + i);
+			}
+			blocks.pushBack(p);
+			sizes.pushBack(n);
+		}
+	}
+
+	bool ok = true;
+	for (size_t k = 0; k < blocks.size(); ++k) {
+		for (size_t i = 0; i < sizes[k]; ++i) {
+			ok = ok && blocks[k][i] == static_cast<char>(sizes[k] + i);
+		}
+		MSTD::defaultAlloc::dealloc(blocks[k], sizes[k]);
+	}
+	EXPECT_BASE(ok, "Blocks of different size classes overlapped");
+}
+
+// Resident memory of this process in bytes,
+// 0 if unknown
+static size_t _residentSize()
+{
+#if defined(__linux__)
+	size_t total = 0, resident = 0;
+	std::ifstream statm("/proc/self/statm");
+	if (statm >> total >> resident) {
+		return resident * 4096;
+	}
+#endif
+	return 0;
+}
+
+struct Payload
+{
+	long long data[8];
+};
+
+// Build and destroy large containers, RSS drops once idle
+// chunks are released
+static void _testTrim()
+{
+#ifndef USE_DIRECT_MALLOC
+	MSTD::alloc::trim();
+	auto rssBefore = _residentSize();
+	size_t rssPeak = 0;
+	{
+		List<Payload> li;
+		Map<int, Payload> map;
+		for (int i = 0; i < 200000; ++i) {
+			li.pushBack(Payload{ { i, i, i, i, i, i, i, i } });
+			map.emplace(i, Payload{ { i, i, i, i, i, i, i, i } });
+		}
+		rssPeak = _residentSize();
+	}
+
+	auto released = MSTD::alloc::trim();
+	EXPECT_BASE(released >= 200000 * 2 * sizeof(Payload), "Idle chunks aren't released by trim");
+	EXPECT_BASE_EQ(MSTD::alloc::trim(), 0u, "Trim twice released memory again");
+	auto rssAfter = _residentSize();
+	if (rssPeak > rssBefore) {
+		EXPECT_BASE(rssPeak - rssAfter > (rssPeak - rssBefore) / 2, "RSS doesn't drop after trim");
+	}
+
+	// Pool is still usable after trim
+	List<int> li{ 1, 2, 3 };
+	EXPECT_BASE_EQ(li.size(), 3u, "Allocation after trim failed");
+
+	// Idle chunks are released without trim once 
+	// they exceed threshold, so trim finds no more 
+	// than threshold left
+	const size_t threshold = 1024 * 1024;
+	MSTD::alloc::setTrimThreshold(threshold);
+	{
+		Map<int, Payload> map;
+		for (int i = 0; i < 200000; ++i) {
+			map.emplace(i, Payload{ { i, i, i, i, i, i, i, i } });
+		}
+	}
+	EXPECT_BASE(MSTD::alloc::trim() <= threshold, "Idle chunks over threshold aren't released");
+	MSTD::alloc::setTrimThreshold(static_cast<size_t>(-1));
+#endif // USE_DIRECT_MALLOC
+}
+
+// Counters follow allocations, only built with USE_ALLOC_STATS
+static void _testStats()
+{
+#ifdef USE_ALLOC_STATS
+	using MSTD::defaultAlloc;
+	auto before = defaultAlloc::stats();
+
+	const size_t blockCnt = 100;
+	void *blocks[blockCnt];
+	for (size_t i = 0; i < blockCnt; ++i) {
+		blocks[i] = defaultAlloc::alloc(100);
+	}
+	auto big = defaultAlloc::alloc(64 * 1024);
+
+	auto mid = defaultAlloc::stats();
+	auto blockSize = MSTD::_CentralPool<0>::roundUp(100);
+	EXPECT_BASE_EQ(mid.inUse - before.inUse, blockCnt * blockSize, "Bytes in use aren't counted");
+	EXPECT_BASE(mid.refills > before.refills, "Refills aren't counted");
+	EXPECT_BASE_EQ(mid.fallbacks - before.fallbacks, 1u, "Fallbacks aren't counted");
+	EXPECT_BASE(mid.reserved >= mid.inUse + mid.cached, "Reserved bytes are less than used");
+
+	for (size_t i = 0; i < blockCnt; ++i) {
+		defaultAlloc::dealloc(blocks[i], 100);
+	}
+	defaultAlloc::dealloc(big, 64 * 1024);
+
+	auto after = defaultAlloc::stats();
+	EXPECT_BASE_EQ(after.inUse, before.inUse, "Bytes in use aren't given back");
+
+	std::ostringstream os;
+	defaultAlloc::dumpStats(os);
+	EXPECT_BASE(os.str().find("reserved") != std::string::npos, "Dump of statistics is empty");
+#endif // USE_ALLOC_STATS
+}
+
+// Containers take every node, buffer and map from the arena
+// they are given
+static void _testArena()
+{
+	using IntMap = Map<int, int, std::less<int>, ArenaAllocator<std::pair<const int, int>>>;
+	using IntSet = Set<int, std::less<int>, ArenaAllocator<int>>;
+	using IntList = List<int, ArenaAllocator<int>>;
+	using IntVector = Vector<int, ArenaAllocator<int>>;
+	using IntDeque = Deque<int, ArenaAllocator<int>>;
+
+	MonotonicArena arena(1024);
+	ArenaAllocator<int> alloc(arena);
+	{
+		IntMap map{ ArenaAllocator<std::pair<const int, int>>(arena) };
+		IntSet set{ alloc };
+		IntList list{ alloc };
+		IntVector vec{ alloc };
+		IntDeque deq{ alloc };
+		for (int i = 0; i < 1000; ++i) {
+			map[i] = i;
+			set.insert(i);
+			list.pushBack(i);
+			vec.pushBack(i);
+			deq.pushFront(i);
+		}
+		EXPECT_BASE(arena.used() > 1000 * 5 * sizeof(int), "Containers don't allocate from arena");
+		EXPECT_BASE(arena.reserved() >= arena.used(), "Arena reserves less than it hands out");
+		EXPECT_BASE(map.getAllocator() == alloc, "Map lost the arena");
+		EXPECT_BASE(set.getAllocator() == alloc, "Set lost the arena");
+		EXPECT_BASE(list.getAllocator() == alloc, "List lost the arena");
+		EXPECT_BASE(vec.getAllocator() == alloc, "Vector lost the arena");
+		EXPECT_BASE(deq.getAllocator() == alloc, "Deque lost the arena");
+
+		// Copies keep the arena of the source
+		IntList listCopy(list);
+		EXPECT_BASE(listCopy.getAllocator() == alloc, "Copy of List lost the arena");
+		EXPECT_CONTAINER_EQ(listCopy, list, "Copy of List in arena is broken");
+
+		// Moving into another arena moves elements, not storage
+		MonotonicArena other;
+		IntVector vecOther{ ArenaAllocator<int>(other) };
+		vecOther = MSTD::move(vec);
+		EXPECT_BASE(vecOther.getAllocator().arena() == &other, "Move assignment replaced the arena");
+		EXPECT_BASE_EQ(vecOther.size(), 1000u, "Move between arenas lost elements");
+		EXPECT_BASE(other.used() >= 1000 * sizeof(int), "Move between arenas stole storage");
+
+		IntDeque deqOther(MSTD::move(deq), ArenaAllocator<int>(other));
+		EXPECT_BASE_EQ(deqOther.size(), 1000u, "Move between arenas lost elements");
+		EXPECT_BASE_EQ(deqOther.front(), 999, "Move between arenas broke Deque");
+
+		IntMap mapOther{ ArenaAllocator<std::pair<const int, int>>(other) };
+		mapOther = map;
+		EXPECT_BASE(mapOther == map, "Copy of Map between arenas is broken");
+		mapOther.clear();
+		mapOther = MSTD::move(map);
+		EXPECT_BASE_EQ(mapOther.size(), 1000u, "Move of Map between arenas lost elements");
+	}
+	arena.release();
+	EXPECT_BASE_EQ(arena.used(), 0u, "Arena isn't released");
+	EXPECT_BASE_EQ(arena.reserved(), 0u, "Arena keeps chunks after release");
+
+	// Arena over a buffer of caller
+	alignas(std::max_align_t) char buffer[256];
+	MonotonicArena local(buffer, sizeof(buffer));
+	{
+		IntVector vec{ ArenaAllocator<int>(local) };
+		vec.reserve(16);
+		auto p = reinterpret_cast<char*>(&vec[0]);
+		EXPECT_BASE(p >= buffer && p < buffer + sizeof(buffer), "Buffer of arena isn't used");
+		EXPECT_BASE_EQ(local.reserved(), 0u, "Arena fetched chunk while buffer is free");
+		vec.reserve(1024);
+		EXPECT_BASE(local.reserved() > 0, "Arena doesn't grow out of buffer");
+	}
+
+#ifdef USE_EXCEPTION
+	// Requests whose chunk size wraps around throw
+	// and leave the arena usable
+	MonotonicArena huge;
+	bool thrown = false;
+	try {
+		huge.allocate(static_cast<size_t>(-1) - 8);
+	}
+	catch (const std::bad_alloc &) {
+		thrown = true;
+	}
+	EXPECT_BASE(thrown && huge.reserved() == 0, "Huge request to arena didn't throw");
+	auto small = static_cast<char*>(huge.allocate(100));
+	small[99] = 1;
+	EXPECT_BASE(huge.used() == 100 && huge.reserved() >= 100, "Arena is broken by huge request");
+
+	Vector<char, ArenaAllocator<char>> bytes{ ArenaAllocator<char>(huge) };
+	thrown = false;
+	try {
+		bytes.reserve(bytes.maxSize());
+	}
+	catch (const std::exception &) {
+		thrown = true;
+	}
+	EXPECT_BASE(thrown && bytes.capacity() == 0, "Huge reserve in arena didn't throw");
+#endif // USE_EXCEPTION
+}
+
+static size_t _deallocCalls = 0;
+
+// Arena allocator counting calls of deallocate
+template<typename T>
+class CountingArenaAllocator : public ArenaAllocator<T>
+{
+public:
+	explicit CountingArenaAllocator(MonotonicArena &arena) :
+		ArenaAllocator<T>(arena)
+	{}
+
+	template<typename U>
+	CountingArenaAllocator(const CountingArenaAllocator<U> &that) :
+		ArenaAllocator<T>(that)
+	{}
+
+	void deallocate(T *p, size_t n)
+	{
+		++_deallocCalls;
+		ArenaAllocator<T>::deallocate(p, n);
+	}
+};
+
+// Node containers of trivially destructible values skip
+// the per-node walk when the arena releases memory
+static void _testArenaTeardown()
+{
+	using IntPair = std::pair<const int, int>;
+	using StrPair = std::pair<const int, std::string>;
+	MonotonicArena arena;
+	{
+		Map<int, int, std::less<int>, CountingArenaAllocator<IntPair>> map{ CountingArenaAllocator<IntPair>(arena) };
+		List<int, CountingArenaAllocator<int>> list{ CountingArenaAllocator<int>(arena) };
+		for (int i = 0; i < 1000; ++i) {
+			map[i] = i;
+			list.pushBack(i);
+		}
+		_deallocCalls = 0;
+		map.clear();
+		list.clear();
+		EXPECT_BASE_EQ(_deallocCalls, 0u, "Bulk released nodes are freed one by one");
+		EXPECT_BASE(map.empty() && map.begin() == map.end(), "Map isn't empty after clear");
+		EXPECT_BASE(list.empty() && list.begin() == list.end(), "List isn't empty after clear");
+
+		// Still usable after bulk clear
+		for (int i = 0; i < 100; ++i) {
+			map[i] = i;
+			list.pushFront(i);
+		}
+		EXPECT_BASE_EQ(map.size(), 100u, "Map is broken after bulk clear");
+		EXPECT_BASE_EQ(list.size(), 100u, "List is broken after bulk clear");
+		EXPECT_BASE_EQ(map.find(50)->second, 50, "Map is broken after bulk clear");
+		_deallocCalls = 0;
+	}
+	// Only the head nodes are given back
+	EXPECT_BASE_EQ(_deallocCalls, 2u, "Bulk released nodes are freed one by one");
+
+	{
+		// Elements with destructor are still visited
+		Map<int, std::string, std::less<int>, CountingArenaAllocator<StrPair>> map{ CountingArenaAllocator<StrPair>(arena) };
+		for (int i = 0; i < 100; ++i) {
+			map[i] = std::string(64, 'x');
+		}
+		_deallocCalls = 0;
+		map.clear();
+		EXPECT_BASE_EQ(_deallocCalls, 100u, "Elements with destructor aren't destroyed");
+	}
+	arena.release();
+}
+
+static size_t _chunkAllocs = 0;
+static size_t _chunkDeallocs = 0;
+static bool _chunkSizeOk = true;
+
+static void* _countingChunkAlloc(size_t n)
+{
+	++_chunkAllocs;
+	_chunkSizeOk = _chunkSizeOk && n % (64 * 1024) == 0;
+	return std::malloc(n);
+}
+
+static void _countingChunkDealloc(void *p, size_t)
+{
+	++_chunkDeallocs;
+	std::free(p);
+}
+
+// New chunks come from the provider set, and go back
+// to the one they come from
+static void _testChunkProvider()
+{
+#ifndef USE_DIRECT_MALLOC
+	using MSTD::ChunkProvider;
+	static const ChunkProvider counting = { _countingChunkAlloc, _countingChunkDealloc, 64 * 1024 };
+
+	const size_t blockCnt = 4096;
+	const size_t blockSize = 1000;
+	Vector<void*> blocks;
+	blocks.reserve(blockCnt);
+
+	MSTD::alloc::trim();
+	auto &old = MSTD::alloc::setChunkProvider(counting);
+	for (size_t i = 0; i < blockCnt; ++i) {
+		blocks.pushBack(MSTD::alloc::alloc(blockSize));
+		std::memset(blocks.back(), 0x5a, blockSize);
+	}
+	EXPECT_BASE(_chunkAllocs > 0, "Chunks aren't fetched from provider");
+	EXPECT_BASE(_chunkSizeOk, "Chunk size isn't a multiple of granularity");
+
+	// Chunks are given back to counting provider even
+	// after it's replaced
+	MSTD::alloc::setChunkProvider(MSTD::hugePageChunkProvider());
+	for (auto p : blocks) {
+		MSTD::alloc::dealloc(p, blockSize);
+	}
+	MSTD::alloc::trim();
+	EXPECT_BASE_EQ(_chunkDeallocs, _chunkAllocs, "Chunks aren't given back to their provider");
+
+	// Huge page chunks work whether transparent huge
+	// pages are available or not
+	blocks.clear();
+	for (size_t i = 0; i < blockCnt; ++i) {
+		blocks.pushBack(MSTD::alloc::alloc(blockSize));
+		std::memset(blocks.back(), 0x5a, blockSize);
+	}
+	for (auto p : blocks) {
+		MSTD::alloc::dealloc(p, blockSize);
+	}
+	EXPECT_BASE(MSTD::alloc::trim() >= MSTD::_HUGE_PAGE_SIZE, "Huge page chunks aren't released");
+
+	MSTD::alloc::setChunkProvider(old);
+#endif // USE_DIRECT_MALLOC
+}
+
+// Blocks are resized in place within a size class, and
+// large ones are resized by system with bytes kept
+static void _testReallocate()
+{
+	auto p = static_cast<unsigned char*>(MSTD::alloc::alloc(100));
+	std::memset(p, 0x3c, 100);
+	size_t size = 100;
+#if !defined(USE_DIRECT_MALLOC) && !defined(USE_ALLOC_DEBUG)
+	EXPECT_BASE(MSTD::alloc::tryExpandInPlace(p, 100, 104), "Block isn't expanded within its size class");
+	size = 104;
+	p[103] = 0x3c;
+#endif // !USE_DIRECT_MALLOC && !USE_ALLOC_DEBUG
+	EXPECT_BASE(!MSTD::alloc::tryExpandInPlace(p, size, 4096), "Block is expanded beyond its size class");
+
+	// Small to large, then large to larger
+	const size_t sizes[] = { 3000, 1 << 20, 48 << 20 };
+	bool kept = true;
+	for (auto newSize : sizes) {
+		p = static_cast<unsigned char*>(MSTD::alloc::reallocate(p, size, newSize));
+		for (size_t i = 0; i < 100; ++i) {
+			kept = kept && p[i] == 0x3c;
+		}
+		kept = kept && p[size - 1] == 0x3c;
+		std::memset(p + size, 0x3c, newSize - size);
+		size = newSize;
+	}
+	EXPECT_BASE(kept, "Bytes are lost by growing");
+
+	// Large back to pool
+	p = static_cast<unsigned char*>(MSTD::alloc::reallocate(p, size, 64));
+	EXPECT_BASE(p[0] == 0x3c && p[63] == 0x3c, "Bytes are lost by shrinking");
+	MSTD::alloc::dealloc(p, 64);
+
+	// Objects of allocators
+	Allocator<double> doubles;
+	double *d = doubles.allocate(10);
+	for (int i = 0; i < 10; ++i) {
+		d[i] = i * 0.5;
+	}
+	auto moved = doubles.reallocate(d, 10, 100000);
+	EXPECT_BASE(moved.count >= 100000, "Reallocated storage is too small");
+	EXPECT_BASE(moved.ptr[0] == 0 && moved.ptr[9] == 4.5, "Doubles are lost by reallocate");
+	doubles.deallocate(moved.ptr, moved.count);
+
+	struct alignas(256) Wide { int val; };
+	Allocator<Wide> wides;
+	Wide *w = wides.allocate(3);
+	w[2].val = 7;
+	EXPECT_BASE(!wides.tryExpandInPlace(w, 3, 4), "Over-aligned storage is expanded in place");
+	auto movedWides = wides.reallocate(w, 3, 1000);
+	w = movedWides.ptr;
+	EXPECT_BASE(reinterpret_cast<uintptr_t>(w) % 256 == 0, "Reallocated storage isn't aligned");
+	EXPECT_BASE_EQ(w[2].val, 7, "Over-aligned objects are lost by reallocate");
+	wides.deallocate(w, movedWides.count);
+}
+
+// Blocks of a batch are linked through their first word,
+// containers take and give back nodes in batches
+static void _testBatch()
+{
+#ifdef USE_ALLOC_STATS
+	auto before = MSTD::defaultAlloc::stats();
+#endif // USE_ALLOC_STATS
+
+	const size_t blockCnt = 1000;
+	for (size_t size : { sizeof(void*), size_t(40), size_t(100), size_t(64 * 1024) }) {
+		void *first = MSTD::alloc::allocBatch(size, blockCnt);
+		size_t cnt = 0;
+		bool linked = true;
+		for (void *p = first; p; p = *static_cast<void**>(p)) {
+			linked = linked && ++cnt <= blockCnt;
+			if (!linked) {
+				break;
+			}
+			// Payload after link is writable
+			std::memset(static_cast<char*>(p) + sizeof(void*), 0x5a, size - sizeof(void*));
+		}
+		EXPECT_BASE(linked && cnt == blockCnt, "Batch doesn't hold the count requested");
+		MSTD::alloc::deallocBatch(first, size, blockCnt);
+	}
+	EXPECT_BASE(MSTD::alloc::allocBatch(100, 0) == nullptr, "Empty batch isn't null");
+	MSTD::alloc::deallocBatch(nullptr, 100, 0);
+
+	// Allocator traits take nodes in one batch
+	Allocator<TestNode> al;
+	using Traits = MSTD::AllocatorTraits<Allocator<TestNode>>;
+	TestNode *nodes = Traits::allocateBatch(al, blockCnt);
+	size_t cnt = 0;
+	for (TestNode *p = nodes; p; p = Traits::nextOfBatch(p)) {
+		++cnt;
+	}
+	EXPECT_BASE_EQ(cnt, blockCnt, "Batch of allocator doesn't hold the count requested");
+	Traits::deallocateBatch(al, nodes, blockCnt);
+
+	// Range insertion and teardown of node containers
+	// go through batches
+	{
+		Vector<int> src;
+		for (int i = 0; i < 5000; ++i) {
+			src.pushBack(i % 2500);
+		}
+
+		List<int> list(src.begin(), src.end());
+		EXPECT_CONTAINER_EQ(list, src, "List built from a batch is wrong");
+		list.insert(list.begin(), src.begin(), src.begin() + 10);
+		EXPECT_BASE_EQ(list.size(), 5010u, "Range insertion into list is wrong");
+		EXPECT_BASE_EQ(list.front(), 0, "Range insertion into list is wrong");
+
+		Set<int> set(src.begin(), src.end());
+		EXPECT_BASE_EQ(set.size(), 2500u, "Duplicated nodes are kept in set");
+		int expect = 0;
+		for (auto val : set) {
+			EXPECT_BASE_EQ(val, expect++, "Set built from a batch is wrong");
+		}
+		MSTD::MultiSet<int> multi(src.begin(), src.end());
+		EXPECT_BASE_EQ(multi.size(), 5000u, "Multi set built from a batch is wrong");
+		multi.insert(src.begin(), src.begin() + 100);
+		EXPECT_BASE_EQ(multi.count(50), 3u, "Range insertion into multi set is wrong");
+
+		list.clear();
+		set.clear();
+		EXPECT_BASE(list.empty() && set.empty(), "Containers aren't empty after clear");
+		set.insert(src.begin(), src.end());
+		EXPECT_BASE_EQ(set.size(), 2500u, "Set is broken after batch clear");
+	}
+
+#ifdef USE_ALLOC_STATS
+	auto after = MSTD::defaultAlloc::stats();
+	EXPECT_BASE_EQ(after.inUse, before.inUse, "Bytes of batches aren't given back");
+#endif // USE_ALLOC_STATS
+}
+
+struct alignas(16) Vec4
+{
+	float v[4];
+};
+
+struct alignas(64) PaddedCounter
+{
+	long long count;
+};
+
+struct alignas(4096) PageBlock
+{
+	char data[100];
+};
+
+template<typename T>
+static bool _isAligned(const T *p, size_t align = alignof(T))
+{
+	return reinterpret_cast<uintptr_t>(p) % align == 0;
+}
+
+// Every object is placed at an address aligned to its
+// type, even beyond what the pool gives by default
+static void _testAlignment()
+{
+#ifdef USE_ALLOC_STATS
+	auto before = MSTD::defaultAlloc::stats();
+#endif // USE_ALLOC_STATS
+	for (size_t align = 16; align <= MSTD::_MAX_ALIGN; align *= 2) {
+		bool aligned = true;
+		void *blocks[64];
+		for (size_t i = 0; i < 64; ++i) {
+			// Cover both pooled and large blocks
+			size_t size = i * 997 % 40000 + 1;
+			blocks[i] = MSTD::alloc::allocAligned(size, align);
+			aligned = aligned && reinterpret_cast<uintptr_t>(blocks[i]) % align == 0;
+			std::memset(blocks[i], 0x5a, size);
+		}
+		for (size_t i = 0; i < 64; ++i) {
+			MSTD::alloc::deallocAligned(blocks[i], i * 997 % 40000 + 1, align);
+		}
+		EXPECT_BASE(aligned, "Block isn't aligned as requested");
+	}
+	{
+		Vector<Vec4> vec;
+		List<Vec4> list;
+		Map<int, Vec4> map;
+		Deque<PaddedCounter> deq;
+		bool aligned = true;
+		for (int i = 0; i < 1000; ++i) {
+			vec.pushBack(Vec4{ { 1.f, 2.f, 3.f, 4.f } });
+			list.pushBack(Vec4{ { 1.f, 2.f, 3.f, 4.f } });
+			map[i] = Vec4{ { 1.f, 2.f, 3.f, 4.f } };
+			deq.pushFront(PaddedCounter{ i });
+			aligned = aligned && _isAligned(&vec.back()) && _isAligned(&list.back()) && 
+				_isAligned(&map[i]) && _isAligned(&deq.front());
+		}
+		EXPECT_BASE(aligned, "Over-aligned element isn't aligned in container");
+
+		List<Vec4> batched(vec.begin(), vec.end());
+		aligned = true;
+		for (auto &v : batched) {
+			aligned = aligned && _isAligned(&v);
+		}
+		EXPECT_BASE(aligned, "Over-aligned element isn't aligned in batch");
+
+		Vector<PageBlock> pages(3);
+		EXPECT_BASE(_isAligned(pages.data()), "Page aligned element isn't aligned");
+	}
+	{
+		// Every allocation has its own cache lines
+		using CounterVector = Vector<long long, MSTD::CacheAlignedAllocator<long long>>;
+		CounterVector counters[8];
+		bool aligned = true;
+		for (auto &vec : counters) {
+			for (long long i = 0; i < 10; ++i) {
+				vec.pushBack(i);
+			}
+			aligned = aligned && _isAligned(vec.data(), MSTD::_CACHE_LINE_SIZE);
+		}
+		EXPECT_BASE(aligned, "Cache aligned allocation isn't aligned");
+
+		// Elements lie at the same offset of their own 
+		// lines since nodes are aligned
+		List<int, MSTD::CacheAlignedAllocator<int>> list{ 1, 2, 3, 4, 5 };
+		auto line = MSTD::_CACHE_LINE_SIZE;
+		auto offset = reinterpret_cast<uintptr_t>(&list.front()) % line;
+		uintptr_t prev = 0;
+		aligned = true;
+		for (auto &val : list) {
+			auto addr = reinterpret_cast<uintptr_t>(&val);
+			aligned = aligned && addr % line == offset && addr / line != prev / line;
+			prev = addr;
+		}
+		EXPECT_BASE(aligned, "Cache aligned node isn't aligned");
+	}
+#ifdef USE_ALLOC_STATS
+	auto after = MSTD::defaultAlloc::stats();
+	EXPECT_BASE_EQ(after.inUse, before.inUse, "Bytes of aligned blocks aren't given back");
+#endif // USE_ALLOC_STATS
+}
+
+// Refill batch of a hot slot grows, and shrinks once
+// blocks pile up in it, only built with USE_ALLOC_STATS
+static void _testAdaptiveBatch()
+{
+#ifdef USE_ALLOC_STATS
+	using MSTD::defaultAlloc;
+	using Pool = MSTD::_CentralPool<0>;
+	const size_t blockSize = 24;
+	const size_t blockCnt = 8192;
+	auto idx = Pool::index(blockSize);
+	size_t refills = 0;
+	size_t cached = 0;
+
+	// Fresh thread cache
+	std::thread worker([&]() {
+		Vector<void*> blocks;
+		blocks.reserve(blockCnt);
+		auto before = defaultAlloc::stats();
+		for (size_t i = 0; i < blockCnt; ++i) {
+			blocks.pushBack(defaultAlloc::alloc(blockSize));
+		}
+		refills = defaultAlloc::stats().refills - before.refills;
+		for (auto p : blocks) {
+			defaultAlloc::dealloc(p, blockSize);
+		}
+		auto after = defaultAlloc::stats();
+		cached = after.cached > before.cached ? after.cached - before.cached : 0;
+	});
+	worker.join();
+
+	// A fixed batch of 20 blocks takes over 400 refills
+	EXPECT_BASE(refills < blockCnt / 40, "Refill batch doesn't grow");
+	EXPECT_BASE(cached <= (Pool::_MIN_BATCH + Pool::batchSize(idx)) * Pool::roundUp(blockSize), 
+		"Refill batch doesn't shrink when blocks pile up");
+#endif // USE_ALLOC_STATS
+}
+
+// Blocks allocated by producers are freed by consumers,
+// they travel back through remote lists and keep their
+// contents all the way
+static void _testRemoteFree()
+{
+#ifndef USE_DIRECT_MALLOC
+#ifdef USE_ALLOC_STATS
+	auto before = MSTD::defaultAlloc::stats();
+#endif // USE_ALLOC_STATS
+	{
+		const size_t pairCnt = 2;
+		const size_t blockCnt = 100000;
+		const size_t sizes[] = { sizeof(TestNode), 200, 1000 };
+
+		// Producers hand over blocks in packs of 256
+		std::mutex mutex;
+		std::condition_variable ready;
+		Deque<Vector<TestNode*>> packs;
+		size_t producing = pairCnt;
+		bool ok[pairCnt] = { false };
+
+		auto producer = [&](size_t id) {
+			Vector<TestNode*> pack;
+			for (size_t seq = 0; seq < blockCnt; ++seq) {
+				auto p = static_cast<TestNode*>(MSTD::alloc::alloc(sizes[seq % 3]));
+				p->owner = id;
+				p->seq = seq;
+				pack.pushBack(p);
+				if (pack.size() == 256 || seq == blockCnt - 1) {
+					std::lock_guard<std::mutex> lock(mutex);
+					packs.pushBack(MSTD::move(pack));
+					pack = Vector<TestNode*>();
+					ready.notify_one();
+				}
+			}
+			std::lock_guard<std::mutex> lock(mutex);
+			--producing;
+			ready.notify_all();
+		};
+
+		auto consumer = [&](size_t id) {
+			bool intact = true;
+			while (true) {
+				Vector<TestNode*> pack;
+				{
+					std::unique_lock<std::mutex> lock(mutex);
+					ready.wait(lock, [&]() { return !packs.empty() || producing == 0; });
+					if (packs.empty()) {
+						break;
+					}
+					pack = MSTD::move(packs.front());
+					packs.popFront();
+				}
+				for (auto p : pack) {
+					intact = intact && p->owner < pairCnt && p->seq < blockCnt;
+					MSTD::alloc::dealloc(p, sizes[p->seq % 3]);
+				}
+			}
+			ok[id] = intact;
+		};
+
+		Vector<std::thread> threads;
+		for (size_t i = 0; i < pairCnt; ++i) {
+			threads.pushBack(std::thread(producer, i));
+			threads.pushBack(std::thread(consumer, i));
+		}
+		for (auto &th : threads) {
+			th.join();
+		}
+		for (size_t i = 0; i < pairCnt; ++i) {
+			EXPECT_BASE(ok[i], "Block freed on another thread is corrupted");
+		}
+
+		// Blocks in remote lists are reused by later
+		// allocations and given back by trim
+		List<int> li;
+		for (int i = 0; i < 10000; ++i) {
+			li.pushBack(i);
+		}
+		EXPECT_BASE_EQ(li.back(), 9999, "Allocation from remote lists failed");
+	}
+	MSTD::alloc::trim();
+#ifdef USE_ALLOC_STATS
+	auto after = MSTD::defaultAlloc::stats();
+	EXPECT_BASE_EQ(after.inUse, before.inUse, "Bytes freed on another thread aren't given back");
+	EXPECT_BASE_EQ(after.remote, 0u, "Remote lists aren't drained by trim");
+#endif // USE_ALLOC_STATS
+#endif // USE_DIRECT_MALLOC
+}
+
+// Blocks freed on another thread wait in remote lists of
+// the thread they were allocated on, which takes them 
+// back once its own slot runs dry, only built with 
+// USE_ALLOC_STATS
+static void _testRemoteOwner()
+{
+#if !defined(USE_DIRECT_MALLOC) && defined(USE_ALLOC_STATS)
+	using MSTD::defaultAlloc;
+	const size_t blockSize = 200;
+	const size_t blockCnt = 4096;
+	size_t base = 0;
+	size_t freed = 0;
+	size_t kept = 0;
+	size_t taken = 0;
+
+	// Fresh thread caches for both owner and freer
+	std::thread owner([&]() {
+		base = defaultAlloc::stats().remote;
+		Vector<void*> blocks;
+		blocks.reserve(blockCnt);
+		for (size_t i = 0; i < blockCnt; ++i) {
+			blocks.pushBack(defaultAlloc::alloc(blockSize));
+		}
+
+		std::thread freer([&]() {
+			for (auto p : blocks) {
+				defaultAlloc::dealloc(p, blockSize);
+			}
+		});
+		freer.join();
+		freed = defaultAlloc::stats().remote;
+
+		// Other threads don't take them
+		std::thread stranger([&]() {
+			Vector<void*> others;
+			for (size_t i = 0; i < blockCnt; ++i) {
+				others.pushBack(defaultAlloc::alloc(blockSize));
+			}
+			kept = defaultAlloc::stats().remote;
+			for (auto p : others) {
+				defaultAlloc::dealloc(p, blockSize);
+			}
+		});
+		stranger.join();
+
+		for (size_t i = 0; i < blockCnt; ++i) {
+			blocks[i] = defaultAlloc::alloc(blockSize);
+		}
+		taken = defaultAlloc::stats().remote;
+		for (auto p : blocks) {
+			defaultAlloc::dealloc(p, blockSize);
+		}
+	});
+	owner.join();
+
+	EXPECT_BASE(freed > base, "Blocks freed on another thread don't go to their owner");
+	EXPECT_BASE_EQ(kept, freed, "Blocks in remote lists are taken by another thread");
+	EXPECT_BASE_EQ(taken, base, "Owner doesn't take back blocks in its remote lists");
+#endif // !USE_DIRECT_MALLOC && USE_ALLOC_STATS
+}
+
+// One container type on different backends chosen at runtime
+static void _testMemoryResource()
+{
+	using IntList = List<int, PolymorphicAllocator<int>>;
+	using ListMap = Map<int, IntList, std::less<int>, PolymorphicAllocator<std::pair<const int, IntList>>>;
+	using MapVector = Vector<ListMap, PolymorphicAllocator<ListMap>>;
+
+	auto fill = [](MapVector &vec) {
+		for (int i = 0; i < 10; ++i) {
+			vec.emplaceBack();
+			for (int j = 0; j < 10; ++j) {
+				auto &list = vec.back()[j];
+				for (int k = 0; k < 10; ++k) {
+					list.pushBack(i * 100 + j * 10 + k);
+				}
+			}
+		}
+	};
+	auto check = [](const MapVector &vec) {
+		if (vec.size() != 10) {
+			return false;
+		}
+		for (int i = 0; i < 10; ++i) {
+			for (int j = 0; j < 10; ++j) {
+				auto it = vec[i].find(j);
+				if (it == vec[i].end() || it->second.size() != 10 || it->second.back() != i * 100 + j * 10 + 9) {
+					return false;
+				}
+			}
+		}
+		return true;
+	};
+
+	EXPECT_BASE(PolymorphicAllocator<int>().resource() == MSTD::defaultResource(), "Allocator doesn't take default resource");
+	EXPECT_BASE(*MSTD::poolResource() != *MSTD::newDeleteResource(), "Different backends compare equal");
+	EXPECT_BASE(PolymorphicAllocator<int>(MSTD::poolResource()) == PolymorphicAllocator<double>(MSTD::poolResource()),
+				"Rebound allocators aren't equal");
+
+	// Nested containers take the default resource, so the
+	// whole structure follows it
+	CountingResource counting;
+	auto old = MSTD::setDefaultResource(&counting);
+	{
+		MapVector vec;
+		fill(vec);
+		EXPECT_BASE(check(vec), "Containers on counting resource are broken");
+		EXPECT_BASE(vec.getAllocator().resource() == &counting, "Vector lost the resource");
+		EXPECT_BASE(counting.allocCalls > 1000, "Nested containers don't allocate from default resource");
+
+		// Copies keep the resource of the source
+		MapVector copy(vec);
+		EXPECT_BASE(check(copy), "Copy on counting resource is broken");
+		EXPECT_BASE(copy.getAllocator() == vec.getAllocator(), "Copy lost the resource");
+	}
+	EXPECT_BASE_EQ(counting.inUse, 0u, "Memory isn't given back to resource");
+
+	// Same type on an arena
+	MonotonicResource arena(1024);
+	MSTD::setDefaultResource(&arena);
+	{
+		MapVector vec;
+		fill(vec);
+		EXPECT_BASE(check(vec), "Containers on monotonic resource are broken");
+		EXPECT_BASE(arena.arena().used() > 1000 * sizeof(int), "Containers don't allocate from arena");
+	}
+	arena.release();
+	EXPECT_BASE_EQ(arena.arena().reserved(), 0u, "Monotonic resource keeps chunks after release");
+
+	// Same type on pool and new/delete, given explicitly
+	EXPECT_BASE(MSTD::setDefaultResource(nullptr) == &arena, "Old default resource isn't returned");
+	{
+		MapVector pool{ PolymorphicAllocator<ListMap>(MSTD::poolResource()) };
+		MapVector heap{ PolymorphicAllocator<ListMap>(MSTD::newDeleteResource()) };
+		fill(pool);
+		fill(heap);
+		EXPECT_BASE(check(pool) && check(heap), "Containers on pool or new/delete are broken");
+
+		// Moving between resources moves elements, not storage
+		MapVector moved(MSTD::move(pool), PolymorphicAllocator<ListMap>(MSTD::newDeleteResource()));
+		EXPECT_BASE(check(moved), "Move between resources lost elements");
+		EXPECT_BASE(moved.getAllocator() == heap.getAllocator(), "Move with allocator ignored the resource");
+		heap = moved;
+		EXPECT_BASE(check(heap), "Copy between resources is broken");
+	}
+
+	// Over-aligned blocks from every resource
+	for (MemoryResource *res : { MSTD::poolResource(), MSTD::newDeleteResource(), 
+								 static_cast<MemoryResource*>(&arena) }) {
+		for (size_t align = 8; align <= MSTD::_MAX_ALIGN; align *= 8) {
+			void *p = res->allocate(100, align);
+			EXPECT_BASE_EQ(reinterpret_cast<uintptr_t>(p) % align, 0u, "Resource breaks alignment");
+			std::memset(p, 0xcd, 100);
+			res->deallocate(p, 100, align);
+		}
+	}
+	MSTD::setDefaultResource(old);
+}
+
+#if defined(USE_ALLOC_DEBUG) && !defined(USE_DIRECT_MALLOC)
+static const char *_guardError = nullptr;
+
+// Constructed before any block is allocated, and destroyed
+// at exit before leaks are reported
+static Vector<int> _globalVec;
+
+static void _recordGuardError(const char *what, const void *, size_t)
+{
+	_guardError = what;
+}
+#endif // USE_ALLOC_DEBUG && !USE_DIRECT_MALLOC
+
+// Misuse of pooled blocks is caught in debug mode
+static void _testDebugGuard()
+{
+#if defined(USE_ALLOC_DEBUG) && !defined(USE_DIRECT_MALLOC)
+	using MSTD::defaultAlloc;
+	using Guard = MSTD::_DebugGuard<0>;
+
+	auto old = defaultAlloc::setGuardHandle(_recordGuardError);
+	auto filled = [](const void *p, size_t n, unsigned char byte) {
+		auto bytes = static_cast<const unsigned char*>(p);
+		for (size_t i = 0; i < n; ++i) {
+			if (bytes[i] != byte) {
+				return false;
+			}
+		}
+		return true;
+	};
+
+	// Fresh and freed blocks are poisoned
+	const size_t n = 24;
+	auto live = defaultAlloc::liveBlocks(n);
+	auto p = static_cast<unsigned char*>(defaultAlloc::alloc(n));
+	EXPECT_BASE(filled(p, n, Guard::_NEW_BYTE), "Fresh block isn't poisoned");
+	EXPECT_BASE_EQ(defaultAlloc::liveBlocks(n), live + 1, "Live block isn't counted");
+	defaultAlloc::dealloc(p, n);
+	EXPECT_BASE(filled(p, n, Guard::_FREED_BYTE), "Freed block isn't poisoned");
+	EXPECT_BASE_EQ(defaultAlloc::liveBlocks(n), live, "Freed block is still counted");
+
+	// Write after free is caught when block is reused
+	p[3] = 0;
+	auto q = defaultAlloc::alloc(n);
+	EXPECT_BASE(q == p, "Freed block isn't reused first");
+	EXPECT_BASE(_guardError != nullptr, "Write after free isn't caught");
+	_guardError = nullptr;
+	defaultAlloc::dealloc(q, n);
+	EXPECT_BASE(_guardError == nullptr, "Reused block is broken");
+
+	// Double free
+	defaultAlloc::dealloc(q, n);
+	EXPECT_BASE(_guardError != nullptr, "Double free isn't caught");
+	_guardError = nullptr;
+
+	// Wrong size, the block is still usable
+	p = static_cast<unsigned char*>(defaultAlloc::alloc(n));
+	defaultAlloc::dealloc(p, n + 1);
+	EXPECT_BASE(_guardError != nullptr, "Dealloc of wrong size isn't caught");
+	_guardError = nullptr;
+	defaultAlloc::dealloc(p, 4 * n);
+	EXPECT_BASE(_guardError != nullptr, "Dealloc of wrong size class isn't caught");
+	_guardError = nullptr;
+	defaultAlloc::dealloc(p, n);
+	EXPECT_BASE(_guardError == nullptr, "Block is broken by dealloc of wrong size");
+
+	// Overflow into red zone, the block is never reused
+	p = static_cast<unsigned char*>(defaultAlloc::alloc(n));
+	p[n] = 0;
+	defaultAlloc::dealloc(p, n);
+	EXPECT_BASE(_guardError != nullptr, "Overflow isn't caught");
+	_guardError = nullptr;
+	q = defaultAlloc::alloc(n);
+	EXPECT_BASE(q != p, "Block with broken red zone is reused");
+	defaultAlloc::dealloc(q, n);
+
+	// Containers use blocks correctly
+	{
+		List<int> list{ 1, 2, 3, 4, 5 };
+		Map<int, int> map{ { 1, 1 }, { 2, 2 }, { 3, 3 } };
+		list.remove(3);
+		map.erase(2);
+		Vector<List<int>> vec(10, list);
+		vec.clear();
+	}
+	EXPECT_BASE(_guardError == nullptr, "Containers misuse pooled blocks");
+
+	// Blocks held are reported
+	p = static_cast<unsigned char*>(defaultAlloc::alloc(n));
+	auto out = std::tmpfile();
+	EXPECT_BASE(defaultAlloc::reportLeaks(out) >= 1, "Held block isn't reported");
+	std::rewind(out);
+	char line[128] = {};
+	EXPECT_BASE(std::fgets(line, sizeof(line), out) && std::strstr(line, "leaked"), "Leak report isn't printed");
+	std::fclose(out);
+	defaultAlloc::dealloc(p, n);
+
+#if defined(__linux__)
+	// Blocks of a global container aren't reported
+	// at exit, checked on a child process
+	out = std::tmpfile();
+	std::fflush(stderr);
+	auto pid = fork();
+	if (pid == 0) {
+		dup2(fileno(out), 2);
+		_globalVec.pushBack(1);
+		std::exit(0);
+	}
+	int status = 0;
+	waitpid(pid, &status, 0);
+	std::rewind(out);
+	bool reported = false;
+	while (std::fgets(line, sizeof(line), out)) {
+		reported = reported || std::strstr(line, "leaked");
+	}
+	std::fclose(out);
+	EXPECT_BASE(pid > 0 && WIFEXITED(status) && !reported, "Blocks of global container are reported as leaks");
+#endif
+
+	defaultAlloc::setGuardHandle(old);
+#endif // USE_ALLOC_DEBUG && !USE_DIRECT_MALLOC
+}
+
+void testAlloc()
+{
+	_testSizeClass();
+	_testMixedSize();
+	_testConcurrentAlloc();
+	_testCrossThreadFree();
+	_testTrim();
+	_testStats();
+	_testArena();
+	_testArenaTeardown();
+	_testChunkProvider();
+	_testBatch();
+	_testReallocate();
+	_testAlignment();
+	_testAdaptiveBatch();
+	_testRemoteFree();
+	_testRemoteOwner();
+	_testMemoryResource();
+	_testDebugGuard();
+}
@@ -0,0 +1,413 @@
+#include <Container/Deque.h>
+#include <Alloc/MemoryResource.h>
+#include <Container/List.h>
+#include <Container/Vector.h>
+#include <Algorithm/Algorithm.h>
+#include <Algorithm/Numeric.h>
+#include <iostream>
+#include <string>
+#include "../TestUtility.h"
+#include "../TestResource.h"
+
+using MSTD::Deque;
+using MSTD::PolymorphicAllocator;
+
+struct Big
+{
+	char bytes[1000];
+	int val;
+
+	Big(int v = 0) : val(v) {}
+};
+
+static void _testBasic()
+{
+	Deque<int> deq{ 1, 2, 3 };
+	deq.pushFront(0);
+	deq.pushBack(4);
+	int arr[5] = { 0, 1, 2, 3, 4 };
+	EXPECT_RANGE_EQ(deq.begin(), deq.end(), arr, arr + 5, "Push at both ends failed");
+
+	// Use Deque as a FIFO queue, so that map is
+	// recentered while buffers are recycled
+	Deque<int> que;
+	bool ok = true;
+	for (int round = 0; round < 4; ++round) {
+		for (int i = 0; i < 2000; ++i) {
+			que.pushBack(i);
+		}
+		for (int i = 0; i < 2000; ++i) {
+			ok = ok && que.front() == i;
+			que.popFront();
+		}
+	}
+	EXPECT_BASE(ok, "Deque as a queue lost elements");
+	EXPECT_BASE(que.empty(), "Deque isn't empty after popping all");
+}
+
+static void _testBlockSize()
+{
+	EXPECT_BASE_EQ((Deque<int>::_BLOCK_SIZE), 128u, "Buffer of int doesn't take 512 bytes");
+	EXPECT_BASE_EQ((Deque<Big>::_BLOCK_SIZE), 16u, "Buffer of large elements holds too few");
+
+	// Buffers of a few elements, iterators cross them often
+	Deque<int, MSTD::Allocator<int>, 3> deq;
+	for (int i = 0; i < 20; ++i) {
+		deq.pushBack(i);
+		deq.pushFront(-i);
+	}
+	bool ok = true;
+	for (int i = 0; i < 40; ++i) {
+		ok = ok && deq[i] == (i < 20 ? i - 19 : i - 20);
+	}
+	EXPECT_BASE(ok, "Deque of small buffers failed");
+	EXPECT_BASE_EQ(deq.end() - deq.begin(), 40, "Distance over small buffers failed");
+	EXPECT_BASE_EQ(*(deq.begin() + 25), 5, "Advance over small buffers failed");
+	EXPECT_BASE_EQ(*(deq.end() - 38), -17, "Advance back over small buffers failed");
+
+	Deque<Big> bigs;
+	for (int i = 0; i < 100; ++i) {
+		bigs.pushBack(Big(i));
+	}
+	EXPECT_BASE(bigs.front().val == 0 && bigs[57].val == 57 && bigs.back().val == 99,
+		"Deque of large elements failed");
+}
+
+// Buffers emptied at one end are reused at the other
+static void _testSpareBlocks()
+{
+	CountingResource res;
+	{
+		Deque<int, PolymorphicAllocator<int>> que{ PolymorphicAllocator<int>(&res) };
+		for (int i = 0; i < 1000; ++i) {
+			que.pushBack(i);
+		}
+		for (int i = 0; i < 500; ++i) {
+			que.popFront();
+		}
+
+		// Steady queue crossing buffer boundaries
+		auto calls = res.allocCalls;
+		bool ok = true;
+		for (int i = 1000; i < 100000; ++i) {
+			que.pushBack(i);
+			ok = ok && que.front() == i - 500;
+			que.popFront();
+		}
+		EXPECT_BASE(ok, "Steady queue lost elements");
+		EXPECT_BASE_EQ(res.allocCalls, calls, "Steady queue allocates");
+
+		// Same at the other end
+		calls = res.allocCalls;
+		for (int i = 0; i < 100000; ++i) {
+			que.pushFront(i);
+			que.popBack();
+		}
+		EXPECT_BASE_EQ(res.allocCalls, calls, "Steady queue allocates at front");
+		EXPECT_BASE_EQ(que.size(), 500u, "Steady queue changed size");
+
+		// Push and pop across a buffer boundary, also once
+		// spare buffers are full or buffers are reserved
+		Deque<int, PolymorphicAllocator<int>, 16> osc{ PolymorphicAllocator<int>(&res) };
+		for (int i = 0; i < 160; ++i) {
+			osc.pushBack(i);
+		}
+		for (int i = 0; i < 144; ++i) {
+			osc.popBack();
+		}
+		// First pass trims buffers beyond the room kept
+		osc.popBack();
+		osc.pushBack(0);
+		calls = res.allocCalls;
+		auto used = res.inUse;
+		for (int i = 0; i < 10000; ++i) {
+			osc.popBack();
+			osc.popBack();
+			osc.pushBack(i);
+			osc.pushBack(i);
+		}
+		EXPECT_BASE(res.allocCalls == calls && res.inUse == used, "Oscillation at back reallocates buffers");
+
+		// Pops within a buffer keep reserved buffers, even
+		// once spare ones are full
+		for (int i = 0; i < 8; ++i) {
+			osc.pushBack(i);
+		}
+		osc.reserveBack(64);
+		for (int i = 0; i < 64; ++i) {
+			osc.pushFront(i);
+		}
+		for (int i = 0; i < 64; ++i) {
+			osc.popFront();
+		}
+		calls = res.allocCalls;
+		used = res.inUse;
+		for (int i = 0; i < 10000; ++i) {
+			osc.popBack();
+			osc.pushBack(i);
+		}
+		EXPECT_BASE_EQ(res.inUse, used, "Pops free reserved buffers");
+		for (int i = 0; i < 64; ++i) {
+			osc.pushBack(i);
+		}
+		EXPECT_BASE_EQ(res.allocCalls, calls, "Pushes after pops allocate");
+
+		for (int i = 0; i < 15; ++i) {
+			osc.pushFront(i);
+		}
+		calls = res.allocCalls;
+		for (int i = 0; i < 10000; ++i) {
+			osc.pushFront(i);
+			osc.popFront();
+		}
+		EXPECT_BASE_EQ(res.allocCalls, calls, "Oscillation at front reallocates buffers");
+
+		Deque<int, PolymorphicAllocator<int>> other(MSTD::move(que));
+		other.clear();
+		EXPECT_BASE(que.empty() && other.empty(), "Clear of moved deque failed");
+	}
+	EXPECT_BASE_EQ(res.inUse, 0u, "Spare buffers aren't given back");
+}
+
+static void _testReserve()
+{
+	using CountedDeque = Deque<int, PolymorphicAllocator<int>, 16>;
+
+	CountingResource res;
+	{
+		CountedDeque deq{ PolymorphicAllocator<int>(&res) };
+		deq.pushBack(0);
+
+		deq.reserveBack(1000);
+		auto calls = res.allocCalls;
+		for (int i = 1; i <= 1000; ++i) {
+			deq.pushBack(i);
+		}
+		EXPECT_BASE_EQ(res.allocCalls, calls, "Push after reserveBack allocates");
+
+		deq.reserveFront(500);
+		calls = res.allocCalls;
+		for (int i = 1; i <= 500; ++i) {
+			deq.pushFront(-i);
+		}
+		EXPECT_BASE_EQ(res.allocCalls, calls, "Push after reserveFront allocates");
+
+		// Reserved buffers at one end survive moving the map
+		// for the other end
+		deq.reserveFront(100);
+		deq.reserveBack(5000);
+		calls = res.allocCalls;
+		for (int i = 1; i <= 100; ++i) {
+			deq.pushFront(-500 - i);
+		}
+		EXPECT_BASE_EQ(res.allocCalls, calls, "Reserved front buffers are lost");
+
+		bool ok = deq.size() == 1601;
+		for (int i = 0; ok && i < 1601; ++i) {
+			ok = deq[i] == i - 600;
+		}
+		EXPECT_BASE(ok, "Reserved deque lost elements");
+
+		auto used = res.inUse;
+		for (int i = 0; i < 1500; ++i) {
+			deq.popBack();
+		}
+		deq.shrinkToFit();
+		EXPECT_BASE(res.inUse < used / 4, "Shrink to fit didn't free buffers");
+		ok = deq.size() == 101;
+		for (int i = 0; ok && i < 101; ++i) {
+			ok = deq[i] == i - 600;
+		}
+		EXPECT_BASE(ok, "Shrink to fit lost elements");
+
+		// Grows again at both ends
+		for (int i = 0; i < 100; ++i) {
+			deq.pushFront(i);
+			deq.pushBack(i);
+		}
+		EXPECT_BASE(deq.front() == 99 && deq.back() == 99 && deq.size() == 301, "Push after shrink failed");
+
+		deq.clear();
+		deq.shrinkToFit();
+		deq.pushBack(7);
+		EXPECT_BASE_EQ(deq.front(), 7, "Shrink of empty deque failed");
+	}
+	EXPECT_BASE_EQ(res.inUse, 0u, "Reserved buffers aren't given back");
+
+	// Popping at the reserved end keeps the room
+	bool ok = true;
+	for (int count = 1; count <= 40; ++count) {
+		CountedDeque deq{ PolymorphicAllocator<int>(&res) };
+		for (int i = 0; i < count; ++i) {
+			deq.pushBack(i);
+			deq.pushFront(i);
+		}
+		deq.reserveBack(100);
+		deq.reserveFront(100);
+		for (int i = 0; i < count; ++i) {
+			deq.popBack();
+			deq.popFront();
+		}
+		auto calls = res.allocCalls;
+		for (int i = 0; i < 100; ++i) {
+			deq.pushBack(i);
+			deq.pushFront(i);
+		}
+		ok = ok && res.allocCalls == calls;
+	}
+	EXPECT_BASE(ok, "Popping drops reserved buffers");
+
+	// Reserved room doesn't grow when popped past
+	{
+		CountedDeque que{ PolymorphicAllocator<int>(&res) };
+		que.reserveFront(100);
+		for (int i = 0; i < 1000; ++i) {
+			que.pushBack(i);
+		}
+		for (int i = 0; i < 1000; ++i) {
+			que.pushBack(i);
+			que.popFront();
+		}
+		auto used = res.inUse;
+		for (int i = 0; i < 100000; ++i) {
+			que.pushBack(i);
+			que.popFront();
+		}
+		EXPECT_BASE_EQ(res.inUse, used, "Queue keeps emptied buffers");
+		EXPECT_BASE_EQ(que.front(), 99000, "Queue lost elements");
+	}
+	EXPECT_BASE_EQ(res.inUse, 0u, "Reserved buffers aren't given back");
+}
+
+static void _testConstruct()
+{
+	using SmallDeque = Deque<std::string, MSTD::Allocator<std::string>, 4>;
+
+	SmallDeque filled(static_cast<size_t>(10), std::string("x"));
+	bool ok = filled.size() == 10;
+	for (auto &str : filled) {
+		ok = ok && str == "x";
+	}
+	EXPECT_BASE(ok, "Construct with count failed");
+
+	std::string strs[] = { "a", "b", "c", "d", "e", "f", "g", "h", "i" };
+	SmallDeque range(strs, strs + 9);
+	EXPECT_RANGE_EQ(range.begin(), range.end(), strs, strs + 9, "Construct from range failed");
+
+	MSTD::List<std::string> list(strs, strs + 9);
+	SmallDeque fromList(list.begin(), list.end());
+	EXPECT_RANGE_EQ(fromList.begin(), fromList.end(), strs, strs + 9, "Construct from list failed");
+
+	range.popFront();
+	SmallDeque copy(range);
+	EXPECT_RANGE_EQ(copy.begin(), copy.end(), strs + 1, strs + 9, "Copy of deque failed");
+
+	filled = copy;
+	EXPECT_BASE(filled == copy, "Copy assignment failed");
+	filled = { "p", "q" };
+	EXPECT_BASE(filled.size() == 2 && filled.back() == "q", "List assignment failed");
+
+	Deque<int> ints(static_cast<size_t>(1000), 3);
+	EXPECT_BASE(ints.size() == 1000 && ints[999] == 3 && ints.end() - ints.begin() == 1000,
+		"Construct many ints failed");
+	ints.pushFront(1);
+	ints.pushBack(2);
+	EXPECT_BASE(ints.front() == 1 && ints.back() == 2 && ints[500] == 3, "Push after bulk construct failed");
+
+	// Pushed value refers to an element of the deque
+	for (int i = 0; i < 300; ++i) {
+		ints.pushBack(ints.front());
+		ints.pushFront(ints.back());
+	}
+	EXPECT_BASE(ints.front() == 1 && ints.back() == 1 && ints.size() == 1602, "Push of own element failed");
+}
+
+// Algorithms run over buffers of a deque one by one
+static void _testSegments()
+{
+	using SmallDeque = Deque<int, MSTD::Allocator<int>, 5>;
+
+	EXPECT_BASE((MSTD::isSegmentedIterator<SmallDeque::Iterator>::value &&
+				 MSTD::isSegmentedIterator<SmallDeque::ConstIterator>::value &&
+				 !MSTD::isSegmentedIterator<int*>::value &&
+				 !MSTD::isSegmentedIterator<MSTD::Vector<int>::Iterator>::value),
+		"Segmented iterators aren't detected");
+
+	// Starts in the middle of a buffer
+	SmallDeque deq;
+	for (int i = 0; i < 20; ++i) {
+		deq.pushBack(i);
+	}
+	for (int i = 1; i <= 3; ++i) {
+		deq.pushFront(-i);
+	}
+	const SmallDeque &cdeq = deq;
+
+	EXPECT_BASE_EQ(MSTD::accumulate(cdeq.begin(), cdeq.end(), 0), 184, "Accumulate over deque failed");
+	EXPECT_BASE_EQ(MSTD::accumulate(deq.begin() + 1, deq.begin() + 1, 5), 5, "Accumulate of empty range failed");
+	EXPECT_BASE_EQ(MSTD::accumulate(deq.begin() + 3, deq.begin() + 8, 1, std::multiplies<int>()), 0,
+		"Accumulate with op over deque failed");
+	EXPECT_BASE_EQ(MSTD::accumulate(deq.begin() + 4, deq.begin() + 10, 1, std::multiplies<int>()), 720,
+		"Accumulate with op over deque failed");
+
+	bool ok = true;
+	for (int i = -3; i < 20; ++i) {
+		auto pos = MSTD::find(cdeq.begin(), cdeq.end(), i);
+		ok = ok && pos - cdeq.begin() == i + 3 && *pos == i;
+	}
+	EXPECT_BASE(ok, "Find over deque failed");
+	EXPECT_BASE(MSTD::find(deq.begin(), deq.end(), 100) == deq.end(), "Find of missing value failed");
+	EXPECT_BASE(MSTD::find(deq.begin(), deq.begin() + 7, 4) == deq.begin() + 7, "Find stops late");
+
+	int arr[23];
+	EXPECT_BASE(MSTD::copy(cdeq.begin(), cdeq.end(), arr) == arr + 23, "Copy from deque failed");
+	EXPECT_RANGE_EQ(deq.begin(), deq.end(), arr, arr + 23, "Copy from deque failed");
+
+	// Destination may end at the end of a buffer, past it is the next one
+	for (auto &val : arr) {
+		val = -val;
+	}
+	ok = true;
+	for (int n = 0; n <= 22; ++n) {
+		ok = ok && MSTD::copy(arr, arr + n, deq.begin() + 1) == deq.begin() + 1 + n;
+	}
+	EXPECT_BASE(ok, "Copy to deque returns wrong position");
+	EXPECT_BASE(deq[0] == -3 && deq[1] == 3 && deq[9] == -5 && deq[22] == -18, "Copy to deque failed");
+
+	MSTD::List<int> list(arr, arr + 5);
+	auto last = MSTD::copy(list.begin(), list.end(), deq.begin());
+	EXPECT_BASE(last == deq.begin() + 5 && deq[4] == -1, "Copy from list to deque failed");
+
+	SmallDeque other(static_cast<size_t>(30), 0);
+	last = MSTD::copy(deq.begin(), deq.end(), other.begin() + 4);
+	EXPECT_BASE(last == other.begin() + 27, "Copy between deques returns wrong position");
+	EXPECT_RANGE_EQ(deq.begin(), deq.end(), other.begin() + 4, other.begin() + 27, "Copy between deques failed");
+	EXPECT_BASE(other[3] == 0 && other[27] == 0, "Copy between deques wrote outside");
+
+	// Fill up to the end of the deque
+	MSTD::fill(other.begin() + 2, other.end(), 9);
+	EXPECT_BASE(other[1] == 0 && other[2] == 9 && other.back() == 9 &&
+				MSTD::count(other.begin(), other.end(), 9) == 28, "Fill over deque failed");
+	EXPECT_BASE(MSTD::fill_N(other.begin(), 3, 7) == other.begin() + 3 && other[2] == 7 && other[3] == 9,
+		"Fill_N over deque failed");
+
+	// Bytes use memchr and memset within buffers
+	Deque<char, MSTD::Allocator<char>, 7> chars;
+	for (int i = 0; i < 50; ++i) {
+		chars.pushBack(static_cast<char>('a' + i % 26));
+	}
+	EXPECT_BASE(MSTD::find(chars.begin() + 1, chars.end(), 'a') - chars.begin() == 26, "Find of char failed");
+	MSTD::fill(chars.begin() + 3, chars.begin() + 40, 'z');
+	EXPECT_BASE(chars[2] == 'c' && chars[3] == 'z' && chars[39] == 'z' && chars[40] == 'o',
+		"Fill of chars failed");
+}
+
+void testDeque()
+{
+	_testBasic();
+	_testBlockSize();
+	_testSpareBlocks();
+	_testReserve();
+	_testConstruct();
+	_testSegments();
+}
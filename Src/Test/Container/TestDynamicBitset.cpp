@@ -0,0 +1,174 @@
+#include <Container/DynamicBitset.h>
+#include <Container/Vector.h>
+#include <Algorithm/Algorithm.h>
+#include <iostream>
+#include <stdexcept>
+#include "../TestUtility.h"
+
+using MSTD::DynamicBitset;
+using MSTD::Vector;
+
+using Bitset = DynamicBitset<>;
+
+// Bits of {bits} are those in {expect}
+static bool _sameBits(const Bitset &bits, const Vector<bool> &expect)
+{
+	if (bits.size() != expect.size()) {
+		return false;
+	}
+	for (size_t i = 0; i < bits.size(); ++i) {
+		if (bits[i] != expect[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static void _testBasic()
+{
+	Bitset bits;
+	EXPECT_BASE(bits.empty() && bits.none() && bits.all(), "Empty bitset failed");
+	EXPECT_BASE_EQ(bits.findFirst(), Bitset::npos, "Empty bitset has a set bit");
+
+	Vector<bool> expect;
+	for (int i = 0; i < 200; ++i) {
+		bits.pushBack(i % 3 == 0);
+		expect.pushBack(i % 3 == 0);
+	}
+	EXPECT_BASE(_sameBits(bits, expect), "Push back failed");
+	EXPECT_BASE_EQ(bits.wordCount(), 4u, "Bits aren't packed in words");
+	EXPECT_BASE_EQ(bits.count(), 67u, "Count failed");
+
+	bits[1] = true;
+	bits.flip(0).reset(3).set(5);
+	EXPECT_BASE(bits[1] && !bits[0] && !bits[3] && bits[5], "Set single bits failed");
+	bits[2] = bits[1];
+	EXPECT_BASE(bits.test(2), "Assign from proxy failed");
+
+	while (bits.size() > 65) {
+		bits.popBack();
+	}
+	EXPECT_BASE(bits.size() == 65 && bits.wordCount() == 2, "Pop back failed");
+	// Bits past the end are dropped
+	EXPECT_BASE_EQ(bits.data()[1], 0u, "Popped bits aren't cleared");
+
+	bits.resize(130, true);
+	EXPECT_BASE(bits[64] == false && bits[65] && bits[129], "Resize with set bits failed");
+	bits.resize(10);
+	bits.resize(70);
+	EXPECT_BASE(!bits[10] && !bits[69], "Resize doesn't clear dropped bits");
+
+	Bitset filled(100, true);
+	EXPECT_BASE(filled.all() && filled.count() == 100, "Construct with set bits failed");
+	filled.reset(99);
+	EXPECT_BASE(!filled.all() && filled.any(), "All after reset failed");
+	filled.flip();
+	EXPECT_BASE(filled.count() == 1 && filled.findFirst() == 99, "Flip all failed");
+	filled.set();
+	EXPECT_BASE(filled.all() && filled.data()[1] >> 36 == 0, "Set all touches bits past the end");
+
+#ifdef USE_EXCEPTION
+	bool thrown = false;
+	try {
+		filled.test(100);
+	}
+	catch (const std::out_of_range &) {
+		thrown = true;
+	}
+	EXPECT_BASE(thrown, "Test out of range didn't throw");
+#endif // USE_EXCEPTION
+}
+
+static void _testFind()
+{
+	Bitset bits(1000);
+	const size_t ones[] = { 3, 63, 64, 65, 500, 998, 999 };
+	for (auto pos : ones) {
+		bits.set(pos);
+	}
+
+	Vector<size_t> found;
+	for (auto pos = bits.findFirst(); pos != Bitset::npos; pos = bits.findNext(pos)) {
+		found.pushBack(pos);
+	}
+	EXPECT_RANGE_EQ(found.begin(), found.end(), ones, ones + 7, "Find set bits failed");
+	EXPECT_BASE_EQ(bits.findNext(999), Bitset::npos, "Find after the last bit failed");
+
+	bits.reset();
+	EXPECT_BASE(bits.none() && bits.findFirst() == Bitset::npos, "Reset all failed");
+}
+
+static void _testBulk()
+{
+	Bitset a{ 1, 1, 0, 0, 1 };
+	Bitset b{ 1, 0, 1, 0, 1 };
+
+	EXPECT_BASE((a & b) == Bitset({ 1, 0, 0, 0, 1 }), "And failed");
+	EXPECT_BASE((a | b) == Bitset({ 1, 1, 1, 0, 1 }), "Or failed");
+	EXPECT_BASE((a ^ b) == Bitset({ 0, 1, 1, 0, 0 }), "Xor failed");
+	Bitset c(a);
+	c.andNot(b);
+	EXPECT_BASE(c == Bitset({ 0, 1, 0, 0, 0 }), "And not failed");
+	EXPECT_BASE((~a == Bitset{ 0, 0, 1, 1, 0 }) && (~a).count() == 2, "Complement sets bits past the end");
+
+	// Large sets are combined word by word
+	Bitset evens(1000);
+	Bitset threes(1000);
+	for (size_t i = 0; i < 1000; ++i) {
+		evens[i] = i % 2 == 0;
+		threes[i] = i % 3 == 0;
+	}
+	auto sixes = evens & threes;
+	EXPECT_BASE_EQ(sixes.count(), 167u, "And of large sets failed");
+	EXPECT_BASE_EQ((evens | threes).count(), 667u, "Or of large sets failed");
+
+#ifdef USE_EXCEPTION
+	bool thrown = false;
+	try {
+		a |= evens;
+	}
+	catch (const std::invalid_argument &) {
+		thrown = true;
+	}
+	EXPECT_BASE(thrown && a.size() == 5, "Or of different sizes didn't throw");
+#endif // USE_EXCEPTION
+}
+
+static void _testIterator()
+{
+	Bitset bits(130);
+	for (auto it = bits.begin(); it != bits.end(); it += 7) {
+		*it = true;
+		if (bits.end() - it <= 7) {
+			break;
+		}
+	}
+	EXPECT_BASE_EQ(static_cast<size_t>(MSTD::count(bits.cbegin(), bits.cend(), true)), 19u, "Iterate with steps failed");
+	EXPECT_BASE_EQ(MSTD::countIf(bits.begin(), bits.end(), [](bool bit) { return !bit; }), 111, "Count of clear bits failed");
+	EXPECT_BASE_EQ(bits.end() - bits.begin(), 130, "Distance of iterators failed");
+
+	auto it = bits.begin() + 70;
+	EXPECT_BASE(*it && it[-63] && !it[1], "Random access failed");
+	it -= 70;
+	EXPECT_BASE(it == bits.begin() && --(bits.begin() + 64) == bits.begin() + 63, "Step back across words failed");
+
+	// Proxies are swapped by algorithms
+	Bitset pattern{ 1, 1, 0, 0, 0 };
+	MSTD::reverse(pattern.begin(), pattern.end());
+	EXPECT_BASE(pattern == Bitset({ 0, 0, 0, 1, 1 }), "Reverse of bits failed");
+	EXPECT_BASE(*pattern.rbegin() && !*(pattern.rend() - 1), "Reverse iterator failed");
+
+	size_t visited = 0;
+	for (bool bit : bits) {
+		visited += bit;
+	}
+	EXPECT_BASE_EQ(visited, bits.count(), "Range for over bits failed");
+}
+
+void testDynamicBitset()
+{
+	_testBasic();
+	_testFind();
+	_testBulk();
+	_testIterator();
+}
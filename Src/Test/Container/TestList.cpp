@@ -1,8 +1,12 @@
 #include <Container/List.h>
 #include <TypeInfo/TypeHelper.h>
 #include <Iterator/Iterator.h>
+#include <Alloc/Allocator.h>
 #include <iostream>
+#include <memory>
+#include <cstring>
 #include <Container/Deque.h>
+#include "../TestUtility.h"
 
 class TestClass
 {
@@ -30,8 +34,55 @@ void printList(const List<T> &li)
 	cout << endl;
 }
 
+// Fills the storage it allocates with a byte pattern
+template<typename T>
+struct PatternAllocator : MSTD::Allocator<T>
+{
+	PatternAllocator() = default;
+
+	template<typename U>
+	PatternAllocator(const PatternAllocator<U> &) noexcept {}
+
+	T* allocate(size_t count)
+	{
+		T *p = MSTD::Allocator<T>::allocate(count);
+		std::memset(static_cast<void*>(p), 0x5A, count * sizeof(T));
+		return p;
+	}
+};
+
+struct RawValue
+{
+	int tag;
+};
+
+static void _testDefaultInit()
+{
+	using RawAlloc = MSTD::DefaultInitAllocator<RawValue, PatternAllocator<RawValue>>;
+	List<RawValue, RawAlloc> raw(static_cast<size_t>(2));
+	raw.resize(4);
+	bool untouched = true;
+	for (auto &&val : raw) {
+		untouched = untouched && val.tag == 0x5A5A5A5A;
+	}
+	EXPECT_BASE(raw.size() == 4 && untouched, "List doesn't construct through DefaultInitAllocator");
+
+	List<RawValue, PatternAllocator<RawValue>> zeroed(static_cast<size_t>(2));
+	zeroed.resize(3);
+	EXPECT_BASE(zeroed.back().tag == 0 && zeroed.front().tag == 0, "List doesn't value-initialize elements");
+
+	// Arguments are forwarded to the member construct
+	List<std::unique_ptr<int>, MSTD::DefaultInitAllocator<std::unique_ptr<int>>> ptrs;
+	std::unique_ptr<int> p(new int(5));
+	ptrs.emplaceBack(std::move(p));
+	ptrs.pushFront(std::unique_ptr<int>(new int(3)));
+	EXPECT_BASE(!p && *ptrs.front() == 3 && *ptrs.back() == 5, "DefaultInitAllocator doesn't forward arguments");
+}
+
 void testList()
 {
+	_testDefaultInit();
+
 	List<int> li{ 1, 2, 3, 4, 5 };
 	printList(li);
 
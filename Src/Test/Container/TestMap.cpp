@@ -6,6 +6,8 @@
 #include <utility>
 #include <iostream>
 #include <functional>
+#include <memory>
+#include "../TestUtility.h"
 
 using MSTD::Map;
 using MSTD::MultiMap;
@@ -64,5 +66,44 @@ void testMap()
 	++table["Frank"];
 	++table["Hue"];
 	printMap(table);
-}
 
+	// Erase half of keys inserted in random order,
+	// the rest are still found in order
+	Map<int, int> rnd;
+	unsigned seed = 1;
+	for (int i = 0; i < 2000; ++i) {
+		seed = seed * 1103515245u + 12345u;
+		rnd.emplace(static_cast<int>((seed >> 8) % 100000), i);
+	}
+	auto total = rnd.size();
+	size_t erased = 0;
+	bool eraseOk = true;
+	for (auto it = rnd.begin(); it != rnd.end(); ) {
+		auto key = it->first;
+		++it;
+		if (key % 2 == 0) {
+			eraseOk = eraseOk && rnd.erase(key) == 1;
+			++erased;
+		}
+	}
+	EXPECT_BASE(eraseOk, "Erase by key failed");
+	EXPECT_BASE_EQ(rnd.size(), total - erased, "Size after erase is wrong");
+	size_t cnt = 0;
+	int prev = -1;
+	bool orderOk = true;
+	for (auto &&val : rnd) {
+		orderOk = orderOk && val.first % 2 == 1 && val.first > prev;
+		prev = val.first;
+		++cnt;
+	}
+	EXPECT_BASE(orderOk && cnt == rnd.size(), "Map is broken after erase");
+
+	// Elements are constructed by the member construct
+	// of the allocator, which gets forwarded arguments
+	using PtrPair = pair<const int, std::unique_ptr<int>>;
+	Map<int, std::unique_ptr<int>, std::less<int>, MSTD::DefaultInitAllocator<PtrPair>> ptrs;
+	std::unique_ptr<int> p(new int(5));
+	ptrs.emplace(5, std::move(p));
+	ptrs.emplace(3, std::unique_ptr<int>(new int(3)));
+	EXPECT_BASE(!p && ptrs.size() == 2 && *ptrs.begin()->second == 3, "Map with DefaultInitAllocator failed");
+}
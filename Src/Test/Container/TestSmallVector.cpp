@@ -0,0 +1,232 @@
+#include <Container/SmallVector.h>
+#include <Alloc/MemoryResource.h>
+#include <Algorithm/Algorithm.h>
+#include <iostream>
+#include <string>
+#include <utility>
+#include "../TestUtility.h"
+#include "../TestResource.h"
+
+using MSTD::SmallVector;
+using MSTD::Vector;
+using MSTD::PolymorphicAllocator;
+
+// Points to itself, so it can't be moved as bytes
+// out of the inline buffer
+struct Anchor
+{
+	Anchor *self;
+	int val;
+
+	Anchor(int v) : self(this), val(v) {}
+	Anchor(const Anchor &that) : self(this), val(that.val) {}
+	Anchor(Anchor &&that) noexcept : self(this), val(that.val) {}
+	Anchor& operator=(const Anchor &that) { val = that.val; return *this; }
+};
+
+// Elements of {vec} are those in {expect}
+template<typename Vec, typename Expect>
+static bool _sameAs(const Vec &vec, const Expect &expect)
+{
+	return vec.size() == expect.size() &&
+		MSTD::equal(vec.begin(), vec.end(), expect.begin());
+}
+
+template<typename Vec>
+static bool _sameAs(const Vec &vec, std::initializer_list<typename Vec::ValueType> expect)
+{
+	return _sameAs(vec, Vector<typename Vec::ValueType>(expect));
+}
+
+using CountedVec = SmallVector<int, 4, PolymorphicAllocator<int>>;
+
+static void _testInline()
+{
+	CountingResource res;
+	{
+		CountedVec vec(&res);
+		EXPECT_BASE(vec.isInline(), "Empty SmallVector isn't inline");
+		EXPECT_BASE_EQ(vec.capacity(), 4u, "Inline capacity isn't N");
+
+		for (int i = 0; i < 4; ++i) {
+			vec.pushBack(i);
+		}
+		EXPECT_BASE(vec.isInline(), "SmallVector spilled within N elements");
+		EXPECT_BASE_EQ(res.allocCalls, 0u, "SmallVector allocated within N elements");
+
+		vec.pushBack(4);
+		EXPECT_BASE(!vec.isInline(), "SmallVector didn't spill over N elements");
+		EXPECT_BASE_EQ(res.allocCalls, 1u, "Spilling allocated more than once");
+		EXPECT_BASE_EQ(vec.capacity(), 8u, "Spilled capacity isn't doubled");
+		EXPECT_BASE(_sameAs(vec, { 0, 1, 2, 3, 4 }), "Elements lost by spilling");
+
+		// Back to the inline buffer once they fit
+		vec.erase(vec.begin() + 1, vec.begin() + 3);
+		vec.shrinkToFit();
+		EXPECT_BASE(vec.isInline(), "Shrinking didn't go back inline");
+		EXPECT_BASE_EQ(res.inUse, 0u, "Spilled memory isn't given back by shrinking");
+		EXPECT_BASE(_sameAs(vec, { 0, 3, 4 }), "Elements lost by shrinking");
+
+		// Inline buffer isn't shrunk
+		vec.shrinkToFit();
+		EXPECT_BASE_EQ(vec.capacity(), 4u, "Inline buffer is shrunk");
+		EXPECT_BASE_EQ(res.allocCalls, 1u, "Shrinking inline elements allocated");
+
+		vec.clear();
+		EXPECT_BASE(vec.empty() && vec.isInline(), "Clear of inline elements failed");
+		vec.insert(vec.begin(), { 9, 8, 7 });
+		vec.emplace(vec.begin() + 1, 5);
+		EXPECT_BASE(_sameAs(vec, { 9, 5, 8, 7 }), "Insert of inline elements failed");
+		EXPECT_BASE_EQ(res.allocCalls, 1u, "Insert within N elements allocated");
+
+		// Reserve spills at once
+		vec.reserve(10);
+		EXPECT_BASE(!vec.isInline() && vec.capacity() == 10, "Reserve over N failed");
+		EXPECT_BASE(_sameAs(vec, { 9, 5, 8, 7 }), "Elements lost by reserve");
+	}
+	EXPECT_BASE_EQ(res.inUse, 0u, "Spilled memory isn't given back");
+}
+
+static void _testConstruct()
+{
+	SmallVector<int, 8> li{ 1, 2, 3 };
+	EXPECT_BASE(_sameAs(li, { 1, 2, 3 }), "Construct from list failed");
+	EXPECT_BASE(li.isInline(), "Small list spilled");
+
+	SmallVector<int, 8> filled(static_cast<size_t>(10), 7);
+	EXPECT_BASE(_sameAs(filled, Vector<int>(static_cast<size_t>(10), 7)), "Construct with count failed");
+	EXPECT_BASE(!filled.isInline(), "Large fill is inline");
+
+	Vector<int> src{ 5, 6, 7, 8 };
+	SmallVector<int, 8> range(src.begin(), src.end());
+	EXPECT_CONTAINER_EQ(range, src, "Construct from range failed");
+
+	SmallVector<int, 8> copy(filled);
+	EXPECT_BASE(copy == filled, "Copy of spilled vector failed");
+	SmallVector<int, 8> inlineCopy(li);
+	EXPECT_BASE(inlineCopy == li && inlineCopy.isInline(), "Copy of inline vector failed");
+	EXPECT_BASE(inlineCopy.data() != li.data(), "Copy shares inline buffer");
+
+	copy = li;
+	EXPECT_BASE(copy == li, "Copy assignment failed");
+	copy = { 4, 3, 2, 1 };
+	EXPECT_BASE(_sameAs(copy, { 4, 3, 2, 1 }), "List assignment failed");
+	li = filled;
+	EXPECT_BASE(li == filled && !li.isInline(), "Copy assignment over N failed");
+}
+
+static void _testMove()
+{
+	CountingResource res;
+	{
+		CountedVec spilled(&res);
+		for (int i = 0; i < 6; ++i) {
+			spilled.pushBack(i);
+		}
+		auto calls = res.allocCalls;
+		auto data = spilled.data();
+
+		// Spilled storage is stolen
+		CountedVec moved(MSTD::move(spilled));
+		EXPECT_BASE_EQ(moved.data(), data, "Spilled storage isn't stolen");
+		EXPECT_BASE_EQ(res.allocCalls, calls, "Move of spilled vector allocated");
+		EXPECT_BASE(spilled.empty() && spilled.isInline(), "Moved vector isn't inline and empty");
+
+		// Moved vector is reusable
+		spilled.pushBack(42);
+		EXPECT_BASE_EQ(spilled.back(), 42, "Moved vector isn't reusable");
+
+		// Inline elements are moved
+		CountedVec small(&res);
+		small.pushBack(1);
+		small.pushBack(2);
+		CountedVec movedSmall(MSTD::move(small));
+		EXPECT_BASE(_sameAs(movedSmall, { 1, 2 }), "Move of inline vector failed");
+		EXPECT_BASE(movedSmall.isInline() && small.empty(), "Move of inline vector isn't inline");
+
+		// Move assignment in both ways
+		movedSmall = MSTD::move(moved);
+		EXPECT_BASE_EQ(movedSmall.data(), data, "Spilled storage isn't stolen by assignment");
+		EXPECT_BASE(moved.empty() && moved.isInline(), "Moved vector isn't inline and empty");
+		moved = MSTD::move(spilled);
+		EXPECT_BASE(_sameAs(moved, { 42 }), "Move assignment of inline vector failed");
+		EXPECT_BASE_EQ(res.allocCalls, calls, "Move assignment allocated");
+
+		// Different resources, elements are moved
+		CountingResource other;
+		CountedVec far(MSTD::move(movedSmall), &other);
+		EXPECT_BASE(_sameAs(far, { 0, 1, 2, 3, 4, 5 }), "Move to other resource failed");
+		EXPECT_BASE_EQ(other.allocCalls, 1u, "Move to other resource didn't allocate");
+		far.clear();
+		far.shrinkToFit();
+		EXPECT_BASE_EQ(other.inUse, 0u, "Memory isn't given back to other resource");
+	}
+	EXPECT_BASE_EQ(res.inUse, 0u, "Spilled memory isn't given back after moves");
+}
+
+static void _testSwap()
+{
+	SmallVector<std::string, 2> a{ "a" };
+	SmallVector<std::string, 2> b{ "b", "c", "d" };
+	SmallVector<std::string, 2> c{ "e", "f", "g", "h" };
+
+	// Inline and spilled
+	swap(a, b);
+	EXPECT_BASE(_sameAs(a, { "b", "c", "d" }), "Swap with spilled failed");
+	EXPECT_BASE(_sameAs(b, { "a" }), "Swap with inline failed");
+	EXPECT_BASE(b.isInline(), "Swapped small vector isn't inline");
+
+	// Both spilled, storage is exchanged
+	auto aData = a.data();
+	auto cData = c.data();
+	a.swap(c);
+	EXPECT_BASE(a.data() == cData && c.data() == aData, "Spilled storage isn't exchanged");
+	EXPECT_BASE(_sameAs(c, { "b", "c", "d" }), "Swap of spilled failed");
+
+	// Both inline
+	SmallVector<std::string, 2> d{ "x", "y" };
+	b.swap(d);
+	EXPECT_BASE(_sameAs(b, { "x", "y" }), "Swap of inline failed");
+	EXPECT_BASE(_sameAs(d, { "a" }), "Swap of inline failed");
+}
+
+// Elements constructed in the inline buffer
+// are moved by constructor
+static void _testNonTrivial()
+{
+	SmallVector<Anchor, 3> anchors;
+	for (int i = 0; i < 10; ++i) {
+		anchors.emplace(anchors.begin(), i);
+	}
+	bool selfOk = true;
+	for (auto &a : anchors) {
+		selfOk = selfOk && a.self == &a;
+	}
+	EXPECT_BASE(selfOk, "Element isn't moved by constructor");
+	EXPECT_BASE(anchors.front().val == 9 && anchors.back().val == 0, "Insert at front failed");
+
+	SmallVector<Anchor, 3> small{ 1, 2 };
+	SmallVector<Anchor, 3> moved(MSTD::move(small));
+	EXPECT_BASE(moved[0].self == &moved[0] && moved[1].val == 2, "Inline element isn't moved by constructor");
+
+	Vector<std::string> expect;
+	SmallVector<std::string, 4> strs;
+	for (int i = 0; i < 20; ++i) {
+		expect.insert(expect.begin() + expect.size() / 2, std::to_string(i));
+		strs.insert(strs.begin() + strs.size() / 2, std::to_string(i));
+	}
+	EXPECT_CONTAINER_EQ(strs, expect, "SmallVector and Vector differ");
+	strs.erase(strs.begin() + 2, strs.end());
+	strs.shrinkToFit();
+	EXPECT_BASE(strs.isInline() && strs.size() == 2, "Strings aren't back inline");
+	EXPECT_RANGE_EQ(strs.begin(), strs.end(), expect.begin(), expect.begin() + 2, "Strings lost by shrinking");
+}
+
+void testSmallVector()
+{
+	_testInline();
+	_testConstruct();
+	_testMove();
+	_testSwap();
+	_testNonTrivial();
+}
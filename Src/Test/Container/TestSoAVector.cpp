@@ -0,0 +1,187 @@
+#include <Container/SoAVector.h>
+#include <Algorithm/Numeric.h>
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include "../TestUtility.h"
+
+using MSTD::SoAVector;
+using MSTD::Vector;
+
+// Counts live objects, copies throw once {copyBudget}
+// runs out, moves may throw as well
+struct Fragile
+{
+	static int live;
+	static int copyBudget;
+	int val;
+
+	Fragile(int v = 0) : val(v) { ++live; }
+	Fragile(const Fragile &that) : val(that.val)
+	{
+		if (copyBudget == 0) {
+			throw std::runtime_error("Copy failed");
+		}
+		--copyBudget;
+		++live;
+	}
+	~Fragile() { --live; }
+};
+
+int Fragile::live = 0;
+int Fragile::copyBudget = -1;
+
+static void _testBasic()
+{
+	SoAVector<int, double, char> vec;
+	EXPECT_BASE(vec.empty() && vec.capacity() == 0, "Empty SoAVector failed");
+	EXPECT_BASE_EQ(vec.fieldCount(), 3u, "Field count failed");
+
+	for (int i = 0; i < 100; ++i) {
+		vec.pushBack(i, i * 0.5, static_cast<char>('a' + i % 26));
+	}
+	EXPECT_BASE_EQ(vec.size(), 100u, "Push rows failed");
+	EXPECT_BASE(vec.capacity() >= 100, "Capacity is too small");
+	EXPECT_BASE(vec[42].get<0>() == 42 && vec[42].get<1>() == 21.0 && vec[42].get<2>() == 'q',
+		"Row access failed");
+	EXPECT_BASE(vec.front().get<0>() == 0 && vec.back().get<0>() == 99, "Front and back failed");
+
+	vec[3].get<1>() = -1.0;
+	EXPECT_BASE_EQ(vec.column<1>()[3], -1.0, "Write through row failed");
+
+	// Every column starts at a cache line
+	EXPECT_BASE(reinterpret_cast<size_t>(vec.column<0>().data()) % MSTD::_CACHE_LINE_SIZE == 0 &&
+				reinterpret_cast<size_t>(vec.column<1>().data()) % MSTD::_CACHE_LINE_SIZE == 0 &&
+				reinterpret_cast<size_t>(vec.column<2>().data()) % MSTD::_CACHE_LINE_SIZE == 0,
+		"Column isn't aligned to cache line");
+
+	vec.popBack();
+	EXPECT_BASE(vec.size() == 99 && vec.back().get<0>() == 98, "Pop row failed");
+
+	vec.resize(120);
+	EXPECT_BASE(vec[119].get<0>() == 0 && vec[119].get<1>() == 0.0, "Resize doesn't value-initialize");
+	vec.resize(10);
+	EXPECT_BASE(vec.size() == 10 && vec[9].get<0>() == 9, "Shrinking resize failed");
+
+	vec.shrinkToFit();
+	EXPECT_BASE(vec.capacity() < 120 && vec[5].get<2>() == 'f', "Shrink to fit failed");
+
+#ifdef USE_EXCEPTION
+	bool thrown = false;
+	try {
+		vec.at(10);
+	}
+	catch (const std::out_of_range &) {
+		thrown = true;
+	}
+	EXPECT_BASE(thrown, "Access out of range didn't throw");
+#endif // USE_EXCEPTION
+
+	vec.clear();
+	EXPECT_BASE(vec.empty() && vec.column<0>().empty(), "Clear failed");
+}
+
+// Columns are consumed by numeric algorithms directly
+static void _testColumns()
+{
+	SoAVector<double, int, double> vec(static_cast<size_t>(50));
+	for (size_t i = 0; i < vec.size(); ++i) {
+		vec[i].get<0>() = static_cast<double>(i);
+		vec[i].get<1>() = 7;
+		vec[i].get<2>() = 2.0;
+	}
+
+	auto xs = vec.column<0>();
+	auto ws = vec.column<2>();
+	EXPECT_BASE_EQ(MSTD::accumulate(xs.begin(), xs.end(), 0.0), 1225.0, "Accumulate of column failed");
+	EXPECT_BASE_EQ(MSTD::innerProduct(xs.begin(), xs.end(), ws.begin(), ws.end(), 0.0), 2450.0,
+		"Inner product of columns failed");
+
+	const auto &cvec = vec;
+	MSTD::ColumnSpan<const int> ids = cvec.column<1>();
+	EXPECT_BASE_EQ(MSTD::accumulate(ids.begin(), ids.end(), 0), 350, "Accumulate of const column failed");
+	EXPECT_BASE(ids.size() == 50 && ids.front() == 7 && ids.back() == 7, "Const column failed");
+
+	Vector<double> copied(xs.begin(), xs.end());
+	EXPECT_RANGE_EQ(copied.begin(), copied.end(), xs.begin(), xs.end(), "Column isn't a range");
+}
+
+static void _testLifetime()
+{
+	{
+		SoAVector<std::string, Fragile> vec;
+		for (int i = 0; i < 20; ++i) {
+			vec.emplaceBack(std::to_string(i), i);
+		}
+		EXPECT_BASE_EQ(Fragile::live, 20, "Growth leaks rows");
+
+		// Arguments referring to rows survive growth
+		while (vec.size() != vec.capacity()) {
+			vec.emplaceBack("x", 0);
+		}
+		vec.pushBack(vec[3].get<0>(), vec[3].get<1>());
+		EXPECT_BASE(vec.back().get<0>() == "3" && vec.back().get<1>().val == 3, "Row aliasing storage is broken");
+
+		SoAVector<std::string, Fragile> copy(vec);
+		EXPECT_BASE(copy.size() == vec.size() && copy[7].get<0>() == "7" && copy[7].get<1>().val == 7,
+			"Copy of SoAVector failed");
+
+		SoAVector<std::string, Fragile> moved(MSTD::move(copy));
+		EXPECT_BASE(copy.empty() && moved[19].get<0>() == "19", "Move of SoAVector failed");
+
+		SoAVector<std::string, Fragile> other;
+		other.pushBack("a", 1);
+		swap(other, moved);
+		EXPECT_BASE(other[19].get<1>().val == 19 && moved.size() == 1, "Swap of SoAVector failed");
+		EXPECT_BASE_EQ(Fragile::live, static_cast<int>(vec.size() * 2 + 1), "Copies leak rows");
+
+		moved = vec;
+		EXPECT_BASE(moved.size() == vec.size() && moved[0].get<0>() == "0", "Copy assignment failed");
+	}
+	EXPECT_BASE_EQ(Fragile::live, 0, "SoAVector leaks rows");
+
+#ifdef USE_EXCEPTION
+	// Growth copies rows which may throw, vector is kept intact
+	{
+		SoAVector<std::string, Fragile> vec;
+		vec.reserve(4);
+		while (vec.size() != vec.capacity()) {
+			vec.emplaceBack("r", static_cast<int>(vec.size()));
+		}
+		auto size = vec.size();
+
+		bool thrown = false;
+		Fragile::copyBudget = 2;
+		try {
+			vec.emplaceBack("last", -1);
+		}
+		catch (const std::runtime_error &) {
+			thrown = true;
+		}
+		Fragile::copyBudget = -1;
+		EXPECT_BASE(thrown && vec.size() == size, "Throwing growth changed size");
+		EXPECT_BASE(vec[1].get<1>().val == 1 && vec[1].get<0>() == "r", "Throwing growth lost rows");
+		EXPECT_BASE_EQ(Fragile::live, static_cast<int>(size), "Throwing growth leaks rows");
+
+		thrown = false;
+		Fragile::copyBudget = 1;
+		try {
+			SoAVector<std::string, Fragile> copy(vec);
+		}
+		catch (const std::runtime_error &) {
+			thrown = true;
+		}
+		Fragile::copyBudget = -1;
+		EXPECT_BASE(thrown, "Throwing copy didn't throw");
+		EXPECT_BASE_EQ(Fragile::live, static_cast<int>(size), "Throwing copy leaks rows");
+	}
+	EXPECT_BASE_EQ(Fragile::live, 0, "SoAVector leaks rows after throwing");
+#endif // USE_EXCEPTION
+}
+
+void testSoAVector()
+{
+	_testBasic();
+	_testColumns();
+	_testLifetime();
+}
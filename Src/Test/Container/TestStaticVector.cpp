@@ -0,0 +1,242 @@
+#include <Container/StaticVector.h>
+#include <Container/Stack.h>
+#include <Container/Queue.h>
+#include <Container/Vector.h>
+#include <Algorithm/Algorithm.h>
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include "../TestUtility.h"
+
+using MSTD::StaticVector;
+using MSTD::Vector;
+
+// Counts live objects, so leaked or double
+// destroyed elements are noticed
+struct Tracked
+{
+	static int live;
+	int val;
+
+	Tracked(int v = 0) : val(v) { ++live; }
+	Tracked(const Tracked &that) : val(that.val) { ++live; }
+	Tracked(Tracked &&that) noexcept : val(that.val) { ++live; }
+	Tracked& operator=(const Tracked &that) { val = that.val; return *this; }
+	Tracked& operator=(Tracked &&that) noexcept { val = that.val; return *this; }
+	~Tracked() { --live; }
+
+	bool operator==(const Tracked &that) const { return val == that.val; }
+	bool operator!=(const Tracked &that) const { return val != that.val; }
+};
+
+int Tracked::live = 0;
+
+// Single pass iterator, copies share the position
+// {next} and the end has none
+struct SinglePass
+{
+	using IteratorCategory = MSTD::InputIteratorTag;
+	using DifferenceType = ptrdiff_t;
+	using ValueType = int;
+	using Reference = int;
+	using Pointer = const int*;
+
+	int *next;
+	int last;
+
+	int operator*() const { return *next; }
+	SinglePass& operator++() { ++*next; return *this; }
+	bool _done() const { return !next || *next == last; }
+	bool operator==(const SinglePass &that) const { return _done() == that._done(); }
+	bool operator!=(const SinglePass &that) const { return !(*this == that); }
+};
+
+// Elements of {vec} are those in {expect}
+template<typename Vec>
+static bool _holds(const Vec &vec, std::initializer_list<int> expect)
+{
+	Vector<int> vals;
+	for (auto &e : vec) {
+		vals.pushBack(static_cast<int>(e));
+	}
+	return vals.size() == expect.size() && MSTD::equal(vals.begin(), vals.end(), expect.begin());
+}
+
+static void _testBasic()
+{
+	static_assert(noexcept(MSTD::declval<StaticVector<int, 4>&>().pushBack(1)), "pushBack isn't noexcept");
+	static_assert(noexcept(MSTD::declval<StaticVector<int, 4>&>().popBack()), "popBack isn't noexcept");
+	EXPECT_BASE((sizeof(StaticVector<int, 4>) <= 4 * sizeof(int) + sizeof(size_t)), "StaticVector isn't stored inline");
+	EXPECT_BASE((MSTD::isTriviallyRelocatable<StaticVector<int, 4>>::value), "StaticVector of int isn't relocatable");
+
+	StaticVector<int, 4> vec;
+	EXPECT_BASE(vec.empty() && vec.capacity() == 4, "Empty StaticVector failed");
+	for (int i = 0; i < 4; ++i) {
+		EXPECT_BASE(vec.pushBack(i), "Push within capacity failed");
+	}
+	EXPECT_BASE(vec.full(), "StaticVector isn't full");
+	EXPECT_BASE(!vec.pushBack(4) && !vec.emplaceBack(5), "Push over capacity succeeded");
+	EXPECT_BASE(_holds(vec, { 0, 1, 2, 3 }), "Push over capacity changed elements");
+
+	EXPECT_BASE(vec.popBack() && vec.size() == 3, "Pop failed");
+	vec.clear();
+	EXPECT_BASE(!vec.popBack(), "Pop of empty vector succeeded");
+
+	vec = { 1, 2, 3 };
+	EXPECT_BASE_EQ(vec.at(2), 3, "Access by at failed");
+	EXPECT_BASE_EQ(*vec.rbegin(), 3, "Reverse iterator failed");
+	vec.insert(vec.begin() + 1, 9);
+	EXPECT_BASE(_holds(vec, { 1, 9, 2, 3 }), "Insert in middle failed");
+	vec.erase(vec.begin(), vec.begin() + 2);
+	EXPECT_BASE(_holds(vec, { 2, 3 }), "Erase range failed");
+	vec.insert(vec.begin(), { 7, 8 });
+	EXPECT_BASE(_holds(vec, { 7, 8, 2, 3 }), "Insert of list failed");
+	vec.erase(vec.begin() + 3);
+	vec.emplace(vec.begin(), 6);
+	EXPECT_BASE(_holds(vec, { 6, 7, 8, 2 }), "Emplace at front failed");
+	vec.resize(2);
+	vec.resize(4, 5);
+	EXPECT_BASE(_holds(vec, { 6, 7, 5, 5 }), "Resize failed");
+
+	StaticVector<int, 4> other{ 1 };
+	EXPECT_BASE(other < vec && vec > other && other != vec, "Compare of StaticVector failed");
+	swap(vec, other);
+	EXPECT_BASE(_holds(vec, { 1 }) && _holds(other, { 6, 7, 5, 5 }), "Swap failed");
+
+#ifdef USE_EXCEPTION
+	bool thrown = false;
+	try {
+		other.insert(other.begin(), 0);
+	}
+	catch (const std::length_error &) {
+		thrown = true;
+	}
+	EXPECT_BASE(thrown && _holds(other, { 6, 7, 5, 5 }), "Insert over capacity didn't throw");
+
+	thrown = false;
+	try {
+		Vector<int> many(static_cast<size_t>(5), 1);
+		StaticVector<int, 4> tooMany(many.begin(), many.end());
+	}
+	catch (const std::length_error &) {
+		thrown = true;
+	}
+	EXPECT_BASE(thrown, "Construct over capacity didn't throw");
+#endif // USE_EXCEPTION
+
+	// Single pass ranges are read once
+	int cursor = 0;
+	StaticVector<int, 8> read(SinglePass{ &cursor, 3 }, SinglePass{ nullptr, 0 });
+	EXPECT_BASE(_holds(read, { 0, 1, 2 }), "Construct from input iterators failed");
+	read.insert(read.begin() + 1, SinglePass{ &cursor, 5 }, SinglePass{ nullptr, 0 });
+	EXPECT_BASE(_holds(read, { 0, 3, 4, 1, 2 }), "Insert of input iterators failed");
+
+#ifdef USE_EXCEPTION
+	thrown = false;
+	try {
+		read.insert(read.begin(), SinglePass{ &cursor, 100 }, SinglePass{ nullptr, 0 });
+	}
+	catch (const std::length_error &) {
+		thrown = true;
+	}
+	EXPECT_BASE(thrown && _holds(read, { 0, 3, 4, 1, 2 }), "Insert of too many input elements didn't throw");
+#endif // USE_EXCEPTION
+}
+
+static void _testLifetime()
+{
+	{
+		StaticVector<Tracked, 8> vec(static_cast<size_t>(3));
+		EXPECT_BASE_EQ(Tracked::live, 3, "Value-initialized elements aren't constructed");
+		vec.emplaceBack(4);
+		vec.insert(vec.begin() + 1, static_cast<size_t>(2), Tracked(7));
+		EXPECT_BASE_EQ(Tracked::live, 6, "Insert leaks elements");
+		vec.erase(vec.begin(), vec.begin() + 2);
+		EXPECT_BASE_EQ(Tracked::live, 4, "Erase leaks elements");
+
+		StaticVector<Tracked, 8> copy(vec);
+		StaticVector<Tracked, 8> moved(MSTD::move(copy));
+		EXPECT_BASE(moved == vec, "Copy and move of StaticVector failed");
+
+		StaticVector<Tracked, 8> small{ 1 };
+		small.swap(moved);
+		EXPECT_BASE(small == vec && moved.size() == 1 && moved[0].val == 1, "Swap of different sizes failed");
+		EXPECT_BASE_EQ(Tracked::live, 4 + 4 + 4 + 1, "Swap leaks elements");
+
+		StaticVector<std::string, 3> strs{ "a", "b" };
+		strs.insert(strs.begin(), "c");
+		EXPECT_BASE(strs[0] == "c" && strs[2] == "b", "Insert of strings failed");
+	}
+	EXPECT_BASE_EQ(Tracked::live, 0, "StaticVector leaks elements");
+}
+
+// Adaptors on StaticVector live on the stack frame
+static void _testAdaptors()
+{
+	MSTD::Stack<int, StaticVector<int, 8>> stack;
+	for (int i = 0; i < 8; ++i) {
+		stack.push(i);
+	}
+	EXPECT_BASE_EQ(stack.top(), 7, "Stack on StaticVector failed");
+	stack.pop();
+	stack.emplace(42);
+	EXPECT_BASE(stack.top() == 42 && stack.size() == 8, "Emplace to stack failed");
+
+	MSTD::PriorityQueue<int, StaticVector<int, 16>> heap;
+	int vals[] = { 5, 3, 9, 1, 7, 2, 8 };
+	for (int v : vals) {
+		heap.push(v);
+	}
+	heap.emplace(0);
+	Vector<int> sorted;
+	while (!heap.empty()) {
+		sorted.pushBack(heap.top());
+		heap.pop();
+	}
+	EXPECT_BASE(_holds(sorted, { 0, 1, 2, 3, 5, 7, 8, 9 }), "PriorityQueue on StaticVector failed");
+
+	MSTD::PriorityQueue<int, StaticVector<int, 16>> other;
+	other.push(4);
+	heap.push(6);
+	heap.swap(other);
+	EXPECT_BASE(heap.top() == 4 && other.top() == 6, "Swap of PriorityQueue failed");
+
+#ifdef USE_EXCEPTION
+	// Full containers make adaptors throw rather than drop elements
+	bool thrown = false;
+	try {
+		stack.push(9);
+	}
+	catch (const std::length_error &) {
+		thrown = true;
+	}
+	EXPECT_BASE(thrown && stack.top() == 42 && stack.size() == 8, "Push to full stack didn't throw");
+
+	MSTD::PriorityQueue<int, StaticVector<int, 2>> full;
+	full.push(1);
+	full.push(3);
+	int tries = 0;
+	try {
+		full.push(5);
+	}
+	catch (const std::length_error &) {
+		++tries;
+	}
+	try {
+		full.emplace(7);
+	}
+	catch (const std::length_error &) {
+		++tries;
+	}
+	EXPECT_BASE(tries == 2 && full.size() == 2 && full.top() == 1, "Push to full PriorityQueue didn't throw");
+	full.pop();
+	EXPECT_BASE(full.top() == 3 && full.size() == 1, "Full PriorityQueue is broken");
+#endif // USE_EXCEPTION
+}
+
+void testStaticVector()
+{
+	_testBasic();
+	_testLifetime();
+	_testAdaptors();
+}
@@ -1,11 +1,288 @@
 #include <Container/Vector.h>
 #include <iostream>
+#include <string>
+#include <utility>
+#include <stdexcept>
+#include <cstring>
 #include "../TestUtility.h"
 
 using MSTD::Vector;
 using std::cout;
 using std::endl;
 
+// Points to itself, so it must be moved by constructor
+struct SelfRef
+{
+	SelfRef *self;
+	int val;
+
+	SelfRef(int v) : self(this), val(v) {}
+	SelfRef(const SelfRef &that) : self(this), val(that.val) {}
+	SelfRef(SelfRef &&that) noexcept : self(this), val(that.val) {}
+};
+
+// Owns a heap value and is declared relocatable, its
+// constructor throws on negative values
+struct OwnedInt
+{
+	int *p;
+
+	explicit OwnedInt(int v) : p(nullptr)
+	{
+		if (v < 0) {
+			throw std::runtime_error("negative value");
+		}
+		p = new int(v);
+	}
+	OwnedInt(const OwnedInt &that) : p(new int(*that.p)) {}
+	OwnedInt(OwnedInt &&that) noexcept : p(that.p) { that.p = nullptr; }
+	~OwnedInt() { delete p; }
+};
+
+namespace MSTD {
+	template<>
+	struct isTriviallyRelocatable<OwnedInt> : trueType {};
+}
+
+static void _testRelocation()
+{
+	EXPECT_BASE((MSTD::isTriviallyRelocatable<std::pair<int, int>>::value), "pair<int, int> isn't relocatable");
+	EXPECT_BASE(MSTD::isTriviallyRelocatable<Vector<int>>::value, "Vector isn't relocatable");
+	EXPECT_BASE(!MSTD::isTriviallyRelocatable<SelfRef>::value, "Type pointing to itself is relocatable");
+
+	// Copies of trivial elements
+	Vector<std::pair<int, int>> pairs;
+	for (int i = 0; i < 1000; ++i) {
+		pairs.emplaceBack(i, -i);
+	}
+	Vector<std::pair<int, int>> pairsCopy(pairs);
+	EXPECT_CONTAINER_EQ(pairsCopy, pairs, "Copy of trivial elements failed");
+	pairsCopy.insert(pairsCopy.begin() + 10, pairs.begin(), pairs.begin() + 10);
+	EXPECT_BASE_EQ(pairsCopy.size(), 1010u, "Insert range of trivial elements failed");
+	EXPECT_BASE_EQ(pairsCopy[15].first, 5, "Insert range of trivial elements failed");
+	EXPECT_BASE_EQ(pairsCopy[25].first, 15, "Insert range of trivial elements failed");
+
+	// Nested vectors are relocated as bytes
+	Vector<Vector<int>> nested;
+	for (int i = 0; i < 100; ++i) {
+		nested.emplaceBack(static_cast<size_t>(i + 1), i);
+		if (i % 10 == 0) {
+			nested.insert(nested.begin(), Vector<int>{ i });
+		}
+	}
+	nested.reserve(1000);
+	nested.shrinkToFit();
+	bool nestedOk = nested.size() == 110;
+	for (size_t i = 0; i < nested.size(); ++i) {
+		if (i < 10) {
+			nestedOk = nestedOk && nested[i].size() == 1 && nested[i][0] == static_cast<int>(90 - i * 10);
+		}
+		else {
+			size_t j = i - 10;
+			nestedOk = nestedOk && nested[i].size() == j + 1 && nested[i].back() == static_cast<int>(j);
+		}
+	}
+	EXPECT_BASE(nestedOk, "Relocation of nested vectors failed");
+
+	// Elements pointing to themselves are moved one by one
+	Vector<SelfRef> selfs;
+	for (int i = 0; i < 100; ++i) {
+		selfs.emplaceBack(i);
+	}
+	selfs.insert(selfs.begin(), SelfRef(-1));
+	bool selfOk = true;
+	for (size_t i = 0; i < selfs.size(); ++i) {
+		selfOk = selfOk && selfs[i].self == &selfs[i] && selfs[i].val == static_cast<int>(i) - 1;
+	}
+	EXPECT_BASE(selfOk, "Element pointing to itself is relocated as bytes");
+
+#ifdef USE_EXCEPTION
+	// Failed construction after relocation leaves elements
+	// in old storage untouched
+	Vector<OwnedInt> owned;
+	owned.emplaceBack(0);
+	while (owned.size() < owned.capacity()) {
+		owned.emplaceBack(static_cast<int>(owned.size()));
+	}
+	bool thrown = false;
+	try {
+		owned.emplaceBack(-1);
+	}
+	catch (const std::runtime_error &) {
+		thrown = true;
+	}
+	EXPECT_BASE(thrown, "Construction doesn't throw");
+	bool ownedOk = true;
+	for (size_t i = 0; i < owned.size(); ++i) {
+		ownedOk = ownedOk && *owned[i].p == static_cast<int>(i);
+	}
+	EXPECT_BASE(ownedOk, "Failed growth broke relocated elements");
+	owned.emplaceBack(static_cast<int>(owned.size()));
+	EXPECT_BASE_EQ(*owned.back().p, static_cast<int>(owned.size()) - 1, "Growth after failure failed");
+#endif // USE_EXCEPTION
+}
+
+// New elements left uninitialized for direct writes
+static void _testDefaultInit()
+{
+	// Construct and resize value-initialize
+	Vector<int> zeros(static_cast<size_t>(5));
+	Vector<int> expectZeros(static_cast<size_t>(5), 0);
+	EXPECT_CONTAINER_EQ(zeros, expectZeros, "Construct with count isn't zeroed");
+	zeros.assign(static_cast<size_t>(8), 7);
+	zeros.resize(2);
+	zeros.resize(8);
+	EXPECT_BASE(zeros[1] == 7 && zeros[2] == 0 && zeros[7] == 0, "Resize isn't zeroed");
+
+	// Trivial elements are written in place
+	Vector<char> buffer;
+	char *dest = buffer.appendUninitialized(5);
+	EXPECT_BASE(dest == buffer.data() && buffer.size() == 5, "Append uninitialized failed");
+	std::memcpy(dest, "hello", 5);
+	for (int i = 0; i < 100; ++i) {
+		std::memcpy(buffer.appendUninitialized(5), "world", 5);
+	}
+	EXPECT_BASE_EQ(buffer.size(), 505u, "Append uninitialized in a loop failed");
+	EXPECT_BASE(std::memcmp(buffer.data(), "helloworld", 10) == 0 &&
+				std::memcmp(buffer.data() + 500, "world", 5) == 0, "Bytes written in place are lost");
+	EXPECT_BASE(buffer.capacity() < 1024, "Append uninitialized doesn't grow geometrically");
+
+	buffer.resizeDefaultInit(1000);
+	EXPECT_BASE(buffer.size() == 1000 && buffer[504] == 'd', "Default-init resize lost elements");
+	buffer.resizeDefaultInit(3);
+	EXPECT_BASE(buffer.size() == 3 && buffer[2] == 'l', "Default-init resize doesn't shrink");
+
+	// Non-trivial elements are still constructed
+	Vector<std::string> strs{ "a" };
+	strs.resizeDefaultInit(4);
+	EXPECT_BASE(strs.size() == 4 && strs[0] == "a" && strs[3].empty(), "Default-init resize of strings failed");
+
+	// Allocator decides how resize() constructs
+	using DefaultInitVec = Vector<int, MSTD::DefaultInitAllocator<int>>;
+	DefaultInitVec raw(static_cast<size_t>(4));
+	EXPECT_BASE_EQ(raw.size(), 4u, "Construct with DefaultInitAllocator failed");
+	raw[3] = 42;
+	raw.resize(100);
+	raw.emplaceBack(7);
+	EXPECT_BASE(raw[3] == 42 && raw.back() == 7 && raw.size() == 101, "Resize with DefaultInitAllocator failed");
+	EXPECT_BASE(raw.getAllocator() == MSTD::DefaultInitAllocator<long>(), "Rebound DefaultInitAllocator isn't equal");
+
+	Vector<std::string, MSTD::DefaultInitAllocator<std::string>> rawStrs(static_cast<size_t>(2));
+	rawStrs.emplaceBack("b");
+	EXPECT_BASE(rawStrs[1].empty() && rawStrs[2] == "b", "DefaultInitAllocator of strings failed");
+}
+
+// Counts how storage of vectors is resized
+template<typename T>
+struct ResizeCountingAllocator : MSTD::Allocator<T>
+{
+	static int expands;
+	static int reallocs;
+
+	ResizeCountingAllocator() = default;
+
+	template<typename U>
+	ResizeCountingAllocator(const ResizeCountingAllocator<U> &) noexcept {}
+
+	bool tryExpandInPlace(T *p, size_t n, size_t newCount) noexcept
+	{
+		++expands;
+		return MSTD::Allocator<T>::tryExpandInPlace(p, n, newCount);
+	}
+
+	MSTD::AllocResult<T*, size_t> reallocate(T *p, size_t n, size_t newCount)
+	{
+		++reallocs;
+		return MSTD::Allocator<T>::reallocate(p, n, newCount);
+	}
+};
+
+template<typename T>
+int ResizeCountingAllocator<T>::expands = 0;
+
+template<typename T>
+int ResizeCountingAllocator<T>::reallocs = 0;
+
+static void _testResizeStorage()
+{
+	// Trivially relocatable elements grow their storage
+	// as a whole
+	Vector<long long, ResizeCountingAllocator<long long>> nums;
+	for (long long i = 0; i < 100000; ++i) {
+		nums.pushBack(i);
+	}
+	EXPECT_BASE(ResizeCountingAllocator<long long>::expands > 0 &&
+				ResizeCountingAllocator<long long>::reallocs > 0, "Storage isn't resized by allocator");
+	bool kept = true;
+	for (long long i = 0; i < 100000; ++i) {
+		kept = kept && nums[static_cast<size_t>(i)] == i;
+	}
+	EXPECT_BASE(kept, "Elements are lost by resizing storage");
+
+	nums.reserve(1 << 22);
+	EXPECT_BASE(nums.capacity() >= (1 << 22) && nums.back() == 99999, "Reserve by resizing storage failed");
+
+	// Others are moved one by one
+	Vector<std::string, ResizeCountingAllocator<std::string>> strs;
+	for (int i = 0; i < 100; ++i) {
+		strs.pushBack(std::to_string(i));
+	}
+	EXPECT_BASE_EQ(ResizeCountingAllocator<std::string>::reallocs, 0, "Strings are resized as bytes");
+
+	// Element pushed may live in the storage resized
+	Vector<int> self{ 42 };
+	for (int i = 0; i < 20; ++i) {
+		self.shrinkToFit();
+		self.pushBack(self.front());
+		self.emplaceBack(self.back());
+	}
+	EXPECT_BASE(self.size() == 41 && self.back() == 42, "Element pushed from storage resized is lost");
+}
+
+static void _testGrowthPolicy()
+{
+	EXPECT_BASE_EQ(MSTD::DoubleGrowth::grow(8, 9, 4), 16u, "Double growth failed");
+	EXPECT_BASE_EQ(MSTD::HalfGrowth::grow(8, 9, 4), 12u, "Half growth failed");
+	EXPECT_BASE_EQ(MSTD::HalfGrowth::grow(1, 2, 4), 2u, "Half growth below minimum");
+	EXPECT_BASE_EQ(MSTD::DoubleGrowth::grow(8, 100, 4), 100u, "Growth below minimum");
+	EXPECT_BASE_EQ(MSTD::PageGrowth::grow(1000, 1001, 8), 1536u, "Page growth isn't rounded to pages");
+	auto step = MSTD::SizeClassGrowth::grow(100, 101, 4);
+	EXPECT_BASE(step >= 125 && step < 150, "Size class growth isn't about a quarter");
+
+	// Capacity takes the whole block the allocator gives
+	Vector<char> chars;
+	chars.reserve(100);
+	EXPECT_BASE_EQ(chars.capacity(), MSTD::alloc::goodSize(100), "Capacity isn't rounded up to the block");
+
+	Vector<int, MSTD::Allocator<int>, MSTD::HalfGrowth> half;
+	Vector<int> twice;
+	size_t halfGrowths = 0;
+	size_t twiceGrowths = 0;
+	for (int i = 0; i < 10000; ++i) {
+		auto halfCap = half.capacity();
+		auto twiceCap = twice.capacity();
+		half.pushBack(i);
+		twice.pushBack(i);
+		halfGrowths += half.capacity() != halfCap;
+		twiceGrowths += twice.capacity() != twiceCap;
+	}
+	EXPECT_CONTAINER_EQ(half, twice, "Elements differ by growth policy");
+	EXPECT_BASE(halfGrowths > twiceGrowths, "Half growth doesn't grow more often");
+	EXPECT_BASE(half.capacity() < 10000 * 3 / 2 + 64, "Half growth leaves too much room");
+
+	Vector<double, MSTD::Allocator<double>, MSTD::PageGrowth> paged;
+	for (int i = 0; i < 100000; ++i) {
+		paged.pushBack(i);
+	}
+	EXPECT_BASE_EQ(paged.capacity() * sizeof(double) % 4096, 0u, "Page growth isn't rounded to pages");
+
+	Vector<std::string, MSTD::Allocator<std::string>, MSTD::SizeClassGrowth> strs;
+	for (int i = 0; i < 1000; ++i) {
+		strs.emplaceBack(std::to_string(i));
+	}
+	EXPECT_BASE(strs.size() == 1000 && strs[999] == "999", "Size class growth lost strings");
+}
+
 void testVector()
 {
 	Vector<int> vec1(Vector<int>{1, 2, 3, 4, 5});
@@ -64,4 +341,9 @@ void testVector()
 
 	EXPECT_BASE_EQ(vec, vec, "operator== test failed");
 	EXPECT_BASE_NEQ(vec, vec2, "operator== test failed");
+
+	_testRelocation();
+	_testDefaultInit();
+	_testResizeStorage();
+	_testGrowthPolicy();
 }
\ No newline at end of file
@@ -0,0 +1,32 @@
+#pragma once
+
+// Memory resources for unit test
+
+#include <Alloc/MemoryResource.h>
+
+// Resource over new and delete counting bytes in use
+class CountingResource : public MSTD::MemoryResource
+{
+public:
+	size_t inUse = 0;
+	size_t allocCalls = 0;
+
+protected:
+	void* doAllocate(size_t bytes, size_t align) override
+	{
+		inUse += bytes;
+		++allocCalls;
+		return MSTD::newDeleteResource()->allocate(bytes, align);
+	}
+
+	void doDeallocate(void *p, size_t bytes, size_t align) override
+	{
+		inUse -= bytes;
+		MSTD::newDeleteResource()->deallocate(p, bytes, align);
+	}
+
+	bool doIsEqual(const MSTD::MemoryResource &that) const noexcept override
+	{
+		return this == &that;
+	}
+};
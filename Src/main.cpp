@@ -5,6 +5,15 @@
 #include "Test/TestUtility.h"
 
 extern void testVector();
+extern void testList();
+extern void testMap();
+extern void testSmallVector();
+extern void testStaticVector();
+extern void testDynamicBitset();
+extern void testSoAVector();
+extern void testDeque();
+extern void testAlloc();
+extern void testAlgorithm();
 
 int main()
 {
@@ -13,6 +22,15 @@ int main()
 
 	// Unit Test Example
 	testVector();
+	testList();
+	testMap();
+	testSmallVector();
+	testStaticVector();
+	testDynamicBitset();
+	testSoAVector();
+	testDeque();
+	testAlloc();
+	testAlgorithm();
 
 	// Print Unit Test results
 	MSTD::TestCounter::getInstance().reportResult();